@@ -0,0 +1,168 @@
+/**
+ * @file
+ *
+ * @brief Verifies the SpscRing and InterruptReceiver classes on the host PC with the producer and the consumer running
+ * in two concurrent threads.
+ *
+ * @section spsc_test_build Building:
+ * The test is built on the host PC against the shim stored in the extras/host directory. Building it with the thread
+ * sanitizer additionally verifies that the ring's memory ordering is free of data races:
+ * @code
+ * clang++ -std=c++17 -g -O2 -fsanitize=thread -pthread -Iextras/host -Isrc extras/concurrency/spsc_ring_test.cpp \
+ *     -o spsc_ring_test
+ * ./spsc_ring_test
+ * @endcode
+ *
+ * The test returns 0 if all checks pass and 1 otherwise. The producer thread plays the role of the interrupt service
+ * routine, and the consumer thread plays the role of the application's loop.
+ */
+
+#include <Arduino.h>
+#include <cstdio>
+#include <thread>
+#include "interrupt_receiver.h"
+#include "spsc_ring.h"
+#include "stream_mock.h"
+#include "transport_layer.h"
+
+namespace
+{
+    /// Stores the number of elements transferred through the ring by the ring test.
+    constexpr uint32_t kRingElements = 2000000;
+
+    /// Stores the number of packets transferred through the InterruptReceiver instance by the receiver test.
+    constexpr uint32_t kReceiverPackets = 100000;
+
+    /**
+     * @brief Transfers a sequence of numbers through the SpscRing instance and verifies that the consumer receives
+     * every number exactly once and in order.
+     *
+     * @returns true if the test passed and false otherwise.
+     */
+    bool TestRing()
+    {
+        static SpscRing<uint32_t, 8> ring;
+
+        // Alternates between copying and in-place slot access to exercise both producer interfaces.
+        std::thread producer(
+            []()
+            {
+                for (uint32_t i = 0; i < kRingElements; i++)
+                {
+                    if (i % 2 == 0)
+                    {
+                        while (!ring.Push(i)) std::this_thread::yield();
+                        continue;
+                    }
+
+                    uint32_t* slot;
+                    while ((slot = ring.get_write_slot()) == nullptr) std::this_thread::yield();
+                    *slot = i;
+                    ring.CommitWrite();
+                }
+            }
+        );
+
+        uint32_t errors = 0;
+        for (uint32_t i = 0; i < kRingElements; i++)
+        {
+            uint32_t value = 0;
+            while (!ring.Pop(value)) std::this_thread::yield();
+            if (value != i) errors++;
+        }
+        producer.join();
+
+        printf(
+            "SpscRing: %lu elements transferred, %lu errors\n",
+            static_cast<unsigned long>(kRingElements),
+            static_cast<unsigned long>(errors)
+        );
+        return errors == 0 && ring.get_size() == 0;
+    }
+
+    /**
+     * @brief Frames the packets in the producer thread and decodes them in the consumer thread, verifying that
+     * every packet is received intact and in order.
+     *
+     * @returns true if the test passed and false otherwise.
+     */
+    bool TestReceiver()
+    {
+        using TransportType = TransportLayer<uint16_t, 64, 64>;
+        static CompactStreamMock<256> tx_port;
+        static CompactStreamMock<256> rx_port;
+        static TransportType transmitter(tx_port, 0x1021, 0xFFFF, 0x0000);
+        static TransportType receiver(rx_port, 0x1021, 0xFFFF, 0x0000);
+
+        // Uses a 1-second inter-byte timeout, so that the scheduling of the threads never abandons a packet.
+        receiver.SetTimeouts(1000000, 0);
+        static InterruptReceiver<TransportType, 4> interrupt_receiver(receiver);
+
+        // Encodes each packet and feeds it to the receiver byte by byte. The producer waits for a free queue slot
+        // before each packet, so that no packets are dropped.
+        std::thread producer(
+            []()
+            {
+                uint8_t payload[64];
+                for (uint32_t i = 0; i < kReceiverPackets; i++)
+                {
+                    const uint8_t payload_size = 4 + i % 60;
+                    for (uint8_t j = 0; j < payload_size; j++) payload[j] = static_cast<uint8_t>(i * 31 + j);
+                    memcpy(payload, &i, sizeof(i));
+                    tx_port.reset();
+                    transmitter.WriteData(payload, payload_size);
+                    transmitter.SendData();
+
+                    while (interrupt_receiver.get_pending_packets() == 4) std::this_thread::yield();
+                    const uint8_t* packet    = tx_port.get_transmitted_data();
+                    const size_t packet_size = tx_port.get_transmitted_size();
+                    for (size_t j = 0; j < packet_size; j++) interrupt_receiver.IngestByte(packet[j]);
+                }
+            }
+        );
+
+        uint32_t errors = 0;
+        uint8_t payload[64];
+        for (uint32_t i = 0; i < kReceiverPackets; i++)
+        {
+            while (!interrupt_receiver.ReceiveData())
+            {
+                if (interrupt_receiver.get_runtime_status() ==
+                    static_cast<uint8_t>(kInterruptReceiverStatusCodes::kPacketRejected))
+                {
+                    errors++;
+                    break;
+                }
+                std::this_thread::yield();
+            }
+
+            const uint8_t payload_size = receiver.get_bytes_in_reception_buffer();
+            uint32_t index             = 0;
+            if (!receiver.ReadData(payload, payload_size) || payload_size != 4 + i % 60) errors++;
+            memcpy(&index, payload, sizeof(index));
+            if (index != i) errors++;
+            for (uint8_t j = sizeof(index); j < payload_size; j++)
+            {
+                if (payload[j] != static_cast<uint8_t>(i * 31 + j)) errors++;
+            }
+        }
+        producer.join();
+
+        printf(
+            "InterruptReceiver: %lu packets framed, %lu dropped, %lu framing errors, %lu payload errors\n",
+            static_cast<unsigned long>(interrupt_receiver.get_framed_packets()),
+            static_cast<unsigned long>(interrupt_receiver.get_dropped_packets()),
+            static_cast<unsigned long>(interrupt_receiver.get_framing_errors()),
+            static_cast<unsigned long>(errors)
+        );
+        return errors == 0 && interrupt_receiver.get_framed_packets() == kReceiverPackets &&
+               interrupt_receiver.get_dropped_packets() == 0 && interrupt_receiver.get_framing_errors() == 0;
+    }
+}  // namespace
+
+int main()
+{
+    const bool ring_passed     = TestRing();
+    const bool receiver_passed = TestReceiver();
+    return ring_passed && receiver_passed ? 0 : 1;
+}
@@ -0,0 +1,278 @@
+/**
+ * @file
+ *
+ * @brief Stress-tests the TransportLayer class on the host PC by streaming packets from one thread into a
+ * thread-safe Stream while another thread receives them.
+ *
+ * @section stress_build Building:
+ * The stress test is built on the host PC against the shim stored in the extras/host directory:
+ * @code
+ * clang++ -std=c++17 -g -O2 -pthread -Iextras/host -Isrc extras/concurrency/transport_layer_stress.cpp \
+ *     -o transport_layer_stress
+ * ./transport_layer_stress [packet_count] [packets_per_second]
+ * @endcode
+ *
+ * The test transmits 2000000 packets by default. If packets_per_second is 0 (default), the producer transmits the
+ * packets as fast as the stream accepts them, which measures the sustained reception throughput. Otherwise, the
+ * producer paces the packets to the requested rate, which measures the reception latency under a controlled load.
+ *
+ * Each packet carries its index, its transmission time, and bytes derived from its index. The consumer verifies every
+ * received payload and reports the throughput, the latency percentiles, and the number of lost or corrupted packets.
+ * The test returns 0 if every packet was received intact and in order and 1 otherwise.
+ *
+ * @note Building the test with -fsanitize=thread additionally verifies that the reception pipeline does not race
+ * with the concurrent writer. Reduce the packet count when doing so, as the sanitizer slows the test down
+ * considerably.
+ */
+
+#include <Arduino.h>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <thread>
+#include <vector>
+#include "transport_layer.h"
+
+namespace
+{
+    /**
+     * @brief Implements the Stream interface using a lock-free single-producer, single-consumer byte ring, so that
+     * one thread can write to the stream while another thread reads from it.
+     *
+     * @tparam kCapacity The size of the ring, in bytes. Must be a power of two.
+     */
+    template <const size_t kCapacity>
+    class ConcurrentStreamMock final : public Stream
+    {
+            static_assert(
+                (kCapacity & (kCapacity - 1)) == 0,
+                "ConcurrentStreamMock's kCapacity template parameter must be a power of two."
+            );
+
+        public:
+            using Print::write;
+
+            /// Writes the input byte to the ring, blocking until the ring has free space.
+            size_t write(const uint8_t value) override
+            {
+                return write(&value, 1);
+            }
+
+            /// Writes the input bytes to the ring, blocking until all bytes are written.
+            size_t write(const uint8_t* buffer, const size_t size) override
+            {
+                size_t written = 0;
+                while (written < size)
+                {
+                    const size_t head  = _head.load(std::memory_order_relaxed);
+                    const size_t space = kCapacity - (head - _tail.load(std::memory_order_acquire));
+                    if (space == 0)
+                    {
+                        std::this_thread::yield();
+                        continue;
+                    }
+
+                    const size_t chunk = std::min(space, size - written);
+                    for (size_t i = 0; i < chunk; i++) _buffer[(head + i) & (kCapacity - 1)] = buffer[written + i];
+                    _head.store(head + chunk, std::memory_order_release);
+                    written += chunk;
+                }
+                return written;
+            }
+
+            /// Returns the number of bytes that can be written to the ring without blocking.
+            int availableForWrite() override
+            {
+                return static_cast<int>(kCapacity - (_head.load(std::memory_order_relaxed) - _tail.load()));
+            }
+
+            /// Returns the number of bytes available for reading.
+            int available() override
+            {
+                return static_cast<int>(_head.load(std::memory_order_acquire) - _tail.load(std::memory_order_relaxed));
+            }
+
+            /// Reads and returns the next available byte, or -1 if no bytes are available.
+            int read() override
+            {
+                const int value = peek();
+                if (value >= 0) _tail.store(_tail.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+                return value;
+            }
+
+            /// Returns the next available byte without consuming it, or -1 if no bytes are available.
+            int peek() override
+            {
+                const size_t tail = _tail.load(std::memory_order_relaxed);
+                if (_head.load(std::memory_order_acquire) == tail) return -1;
+                return _buffer[tail & (kCapacity - 1)];
+            }
+
+        private:
+            /// Stores the ring's bytes.
+            uint8_t _buffer[kCapacity] {};
+
+            /// Stores the free-running index of the next byte to write. Only modified by the writer.
+            std::atomic<size_t> _head {0};
+
+            /// Stores the free-running index of the next byte to read. Only modified by the reader.
+            std::atomic<size_t> _tail {0};
+    };
+
+    /// Stores the header written at the beginning of each stress test payload.
+    struct PACKED_STRUCT PacketHeader
+    {
+            uint32_t index     = 0;  ///< The index of the packet.
+            uint64_t timestamp = 0;  ///< The transmission time of the packet, in nanoseconds.
+    };
+
+    /// The type of the TransportLayer instances used by the stress test. Uses a 16-bit CRC and sequence numbers.
+    using TransportType = TransportLayer<uint16_t, 252, 252, 2>;
+
+    /// Returns the current time, in nanoseconds, measured by the monotonic clock.
+    uint64_t Now()
+    {
+        return static_cast<uint64_t>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch())
+                .count()
+        );
+    }
+
+    /// Returns the payload size of the packet with the input index. Cycles through all payload sizes that fit the
+    /// packet header.
+    uint8_t GetPayloadSize(const uint32_t index)
+    {
+        constexpr uint32_t kSizes = TransportType::get_maximum_transmitted_payload_size() - sizeof(PacketHeader) + 1;
+        return static_cast<uint8_t>(sizeof(PacketHeader) + index % kSizes);
+    }
+
+    /// Returns the payload byte stored at the input offset of the packet with the input index.
+    uint8_t GetPayloadByte(const uint32_t index, const uint8_t offset)
+    {
+        return static_cast<uint8_t>(index * 131 + offset * 7);
+    }
+
+    /// Returns the latency percentile from the sorted latencies, in microseconds.
+    double GetPercentile(const std::vector<uint64_t>& latencies, const double percentile)
+    {
+        if (latencies.empty()) return 0;
+        const auto position = static_cast<size_t>(percentile / 100.0 * static_cast<double>(latencies.size() - 1));
+        return static_cast<double>(latencies[position]) / 1000.0;
+    }
+}  // namespace
+
+int main(const int argc, char** argv)
+{
+    const uint32_t packet_count = argc > 1 ? static_cast<uint32_t>(strtoul(argv[1], nullptr, 10)) : 2000000;
+    const uint32_t packet_rate  = argc > 2 ? static_cast<uint32_t>(strtoul(argv[2], nullptr, 10)) : 0;
+
+    static ConcurrentStreamMock<65536> stream;
+    static TransportType transmitter(stream, 0x1021, 0xFFFF, 0x0000);
+    static TransportType receiver(stream, 0x1021, 0xFFFF, 0x0000);
+
+    // Uses a 1-second inter-byte timeout, so that the scheduling of the threads never abandons a packet.
+    receiver.SetTimeouts(1000000, 0);
+
+    // Transmits the packets, pacing them to the requested rate.
+    const uint64_t start_time = Now();
+    std::thread producer(
+        [packet_count, packet_rate, start_time]()
+        {
+            uint8_t payload[254];
+            for (uint32_t index = 0; index < packet_count; index++)
+            {
+                if (packet_rate != 0)
+                {
+                    const uint64_t due_time = start_time + static_cast<uint64_t>(index) * 1000000000ULL / packet_rate;
+                    while (Now() < due_time) std::this_thread::yield();
+                }
+
+                const uint8_t payload_size = GetPayloadSize(index);
+                for (uint8_t i = sizeof(PacketHeader); i < payload_size; i++) payload[i] = GetPayloadByte(index, i);
+                PacketHeader header;
+                header.index     = index;
+                header.timestamp = Now();
+                memcpy(payload, &header, sizeof(header));
+                transmitter.WriteData(payload, payload_size);
+                transmitter.SendData();
+            }
+        }
+    );
+
+    // Receives and verifies the packets until the last packet is received or the stream stays silent for 1 second.
+    std::vector<uint64_t> latencies;
+    latencies.reserve(packet_count);
+    uint32_t expected_index    = 0;
+    uint32_t corrupted_packets = 0;
+    uint32_t failed_receptions = 0;
+    uint64_t received_bytes    = 0;
+    uint64_t last_reception    = Now();
+    uint8_t payload[254];
+    while (expected_index < packet_count && Now() - last_reception < 1000000000ULL)
+    {
+        if (!receiver.ReceiveData())
+        {
+            if (receiver.get_runtime_status() != static_cast<uint8_t>(kTransportStatusCodes::kNoBytesToParse))
+            {
+                failed_receptions++;
+            }
+            continue;
+        }
+
+        const uint64_t reception_time = Now();
+        last_reception                = reception_time;
+        const uint8_t payload_size    = receiver.get_bytes_in_reception_buffer();
+        PacketHeader header;
+        if (payload_size < sizeof(header) || !receiver.ReadData(payload, payload_size))
+        {
+            corrupted_packets++;
+            continue;
+        }
+        memcpy(&header, payload, sizeof(header));
+
+        bool intact = header.index == expected_index && payload_size == GetPayloadSize(header.index);
+        for (uint8_t i = sizeof(PacketHeader); intact && i < payload_size; i++)
+        {
+            intact = payload[i] == GetPayloadByte(header.index, i);
+        }
+        if (!intact) corrupted_packets++;
+
+        latencies.push_back(reception_time - header.timestamp);
+        received_bytes += payload_size;
+        expected_index = header.index + 1;
+    }
+    const double elapsed_seconds = static_cast<double>(Now() - start_time) / 1e9;
+    producer.join();
+
+    // Reports the results.
+    std::sort(latencies.begin(), latencies.end());
+    const SequenceStatistics& statistics = receiver.get_sequence_statistics();
+    printf(
+        "Received %zu of %lu packets in %.2f s (%.0f packets/s, %.1f MB/s)\n",
+        latencies.size(),
+        static_cast<unsigned long>(packet_count),
+        elapsed_seconds,
+        static_cast<double>(latencies.size()) / elapsed_seconds,
+        static_cast<double>(received_bytes) / elapsed_seconds / 1e6
+    );
+    printf(
+        "Latency (us): p50 %.1f, p90 %.1f, p99 %.1f, p99.9 %.1f, max %.1f\n",
+        GetPercentile(latencies, 50),
+        GetPercentile(latencies, 90),
+        GetPercentile(latencies, 99),
+        GetPercentile(latencies, 99.9),
+        GetPercentile(latencies, 100)
+    );
+    printf(
+        "Corrupted packets: %lu, failed receptions: %lu, missing sequence numbers: %lu\n",
+        static_cast<unsigned long>(corrupted_packets),
+        static_cast<unsigned long>(failed_receptions),
+        static_cast<unsigned long>(statistics.missing_packets)
+    );
+
+    const bool passed = latencies.size() == packet_count && corrupted_packets == 0 && failed_receptions == 0 &&
+                        statistics.missing_packets == 0 && statistics.duplicate_packets == 0;
+    return passed ? 0 : 1;
+}
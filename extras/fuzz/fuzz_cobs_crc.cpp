@@ -0,0 +1,112 @@
+/**
+ * @file
+ *
+ * @brief Provides the libFuzzer harness that directly exercises the COBSProcessor and CRCProcessor classes.
+ *
+ * @section fuzz_codec_build Building:
+ * The harness is built on the host PC using clang with libFuzzer and the address and undefined behavior sanitizers:
+ * @code
+ * clang++ -std=c++17 -g -O1 -fsanitize=fuzzer,address,undefined -DAXTLMC_HOST_VIRTUAL_CLOCK \
+ *     -Iextras/host -Isrc extras/fuzz/fuzz_cobs_crc.cpp -o fuzz_cobs_crc
+ * ./fuzz_cobs_crc -max_len=300 corpus_directory
+ * @endcode
+ *
+ * Compilers without libFuzzer support can build the harness with -DAXTLMC_FUZZ_STANDALONE instead of
+ * -fsanitize=fuzzer (see standalone_driver.h).
+ *
+ * @section fuzz_codec_checks Checks:
+ * Each input is used twice. First, it is treated as an untrusted received packet whose payload size byte is within
+ * the range accepted by the TransportLayer class, and is run through the CRC verification and COBS decoding. Second,
+ * it is treated as a payload that is encoded, checksummed, verified, and decoded, and the decoded payload must match
+ * the original input. Any mismatch aborts the harness, so the fuzzer reports it as a crash.
+ */
+
+#include <Arduino.h>
+#include "cobs_processor.h"
+#include "crc_processor.h"
+
+namespace
+{
+    /// Stores the size of the buffers used by the harness. Fits the largest packet and the 32-bit CRC postamble.
+    constexpr uint16_t kFuzzBufferSize = kBufferLayout::kMaximumPacketSize + kBufferLayout::kPayloadSizeIndex + 5;
+
+    /// Stores the 8-bit CRC processor.
+    CRCProcessor<uint8_t> crc8_processor(0x07, 0x00, 0x00);  // NOLINT(*-avoid-non-const-global-variables)
+
+    /// Stores the 16-bit CRC processor.
+    CRCProcessor<uint16_t> crc16_processor(0x1021, 0xFFFF, 0x0000);  // NOLINT(*-avoid-non-const-global-variables)
+
+    /// Stores the 32-bit CRC processor.
+    CRCProcessor<uint32_t> crc32_processor(  // NOLINT(*-avoid-non-const-global-variables)
+        0x04C11DB7,
+        0xFFFFFFFF,
+        0xFFFFFFFF
+    );
+
+    /**
+     * @brief Copies the input data into the buffer's packet region, starting with the payload size byte.
+     *
+     * @note The payload size byte is clamped to the range that the TransportLayer class accepts before decoding.
+     */
+    void LoadPacket(uint8_t (&buffer)[kFuzzBufferSize], const uint8_t* data, const size_t size)
+    {
+        memset(buffer, 0, sizeof(buffer));
+        buffer[kBufferLayout::kStartByteIndex] = kBufferLayout::kStartByte;
+        const size_t bytes_to_copy = min(size, static_cast<size_t>(kFuzzBufferSize - 1));
+        memcpy(&buffer[kBufferLayout::kPayloadSizeIndex], data, bytes_to_copy);
+        buffer[kBufferLayout::kPayloadSizeIndex] = static_cast<uint8_t>(
+            max(min(buffer[kBufferLayout::kPayloadSizeIndex], kBufferLayout::kMaximumPayloadSize),
+                kBufferLayout::kMinimumPayloadSize)
+        );
+    }
+
+    /**
+     * @brief Encodes, checksums, verifies, and decodes the input payload using the input CRC processor, and aborts if
+     * the decoded payload does not match the input.
+     */
+    template <typename ProcessorType>
+    void RoundTrip(ProcessorType& processor, const uint8_t* data, const uint8_t payload_size)
+    {
+        uint8_t buffer[kFuzzBufferSize] = {};
+        buffer[kBufferLayout::kStartByteIndex]   = kBufferLayout::kStartByte;
+        buffer[kBufferLayout::kPayloadSizeIndex] = payload_size;
+        memcpy(&buffer[kBufferLayout::kPayloadStartIndex], data, payload_size);
+
+        if (COBSProcessor::EncodePayload(buffer) != payload_size + 2) __builtin_trap();
+        processor.template CalculateChecksum<false>(buffer);
+
+        // The encoded region must not contain any unencoded delimiter bytes except the final one.
+        for (uint16_t i = kBufferLayout::kOverheadByteIndex; i <= payload_size + kBufferLayout::kOverheadByteIndex; i++)
+        {
+            if (buffer[i] == kBufferLayout::kDelimiterByte) __builtin_trap();
+        }
+
+        if (processor.template CalculateChecksum<true>(buffer) != 1) __builtin_trap();
+        if (COBSProcessor::DecodePayload(buffer) != payload_size) __builtin_trap();
+        if (memcmp(&buffer[kBufferLayout::kPayloadStartIndex], data, payload_size) != 0) __builtin_trap();
+    }
+}  // namespace
+
+/// Runs the fuzzer-generated data through the packet decoding and payload round-trip checks.
+extern "C" int LLVMFuzzerTestOneInput(const uint8_t* data, const size_t size)
+{
+    // Untrusted packet decoding. The result is irrelevant, as the harness only looks for memory errors and hangs.
+    uint8_t buffer[kFuzzBufferSize];
+    LoadPacket(buffer, data, size);
+    crc8_processor.CalculateChecksum<true>(buffer);
+    crc16_processor.CalculateChecksum<true>(buffer);
+    crc32_processor.CalculateChecksum<true>(buffer);
+    COBSProcessor::DecodePayload(buffer);
+
+    // Payload round trip.
+    if (size < kBufferLayout::kMinimumPayloadSize) return 0;
+    const auto payload_size = static_cast<uint8_t>(min(size, static_cast<size_t>(kBufferLayout::kMaximumPayloadSize)));
+    RoundTrip(crc8_processor, data, payload_size);
+    RoundTrip(crc16_processor, data, payload_size);
+    RoundTrip(crc32_processor, data, payload_size);
+    return 0;
+}
+
+#if defined(AXTLMC_FUZZ_STANDALONE)
+#include "standalone_driver.h"
+#endif
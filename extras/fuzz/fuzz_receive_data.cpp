@@ -0,0 +1,101 @@
+/**
+ * @file
+ *
+ * @brief Provides the libFuzzer harness that feeds arbitrary byte streams to the TransportLayer class reception
+ * pipeline (ParsePacket(), ValidatePacket() and ReadData()).
+ *
+ * @section fuzz_rx_build Building:
+ * The harness is built on the host PC using clang with libFuzzer and the address and undefined behavior sanitizers:
+ * @code
+ * clang++ -std=c++17 -g -O1 -fsanitize=fuzzer,address,undefined -DAXTLMC_HOST_VIRTUAL_CLOCK \
+ *     -Iextras/host -Isrc extras/fuzz/fuzz_receive_data.cpp -o fuzz_receive_data
+ * ./fuzz_receive_data -max_len=4096 corpus_directory
+ * @endcode
+ *
+ * Compilers without libFuzzer support can build the harness with -DAXTLMC_FUZZ_STANDALONE instead of
+ * -fsanitize=fuzzer. The resulting executable replays every input file passed to it as a command-line argument,
+ * which is used to reproduce crashes and to run the corpus as a regression test.
+ *
+ * @note The harness must be compiled with AXTLMC_HOST_VIRTUAL_CLOCK defined. Otherwise, every truncated packet
+ * blocks the harness for the full reception timeout, which reduces the fuzzing throughput by orders of magnitude.
+ */
+
+#include <Arduino.h>
+#include "stream_mock.h"
+#include "transport_layer.h"
+
+namespace
+{
+    /**
+     * @brief Pushes the input byte stream into the instance's communication interface and receives packets until
+     * the stream is exhausted.
+     *
+     * @tparam TransportType the specialization of the TransportLayer class to fuzz.
+     * @param port the CompactStreamMock instance used as the TransportLayer instance's communication interface.
+     * @param transport_layer the TransportLayer instance to fuzz.
+     * @param data the fuzzer-generated byte stream.
+     * @param size the size of the byte stream, in bytes.
+     */
+    template <typename PortType, typename TransportType>
+    void ReceiveStream(PortType& port, TransportType& transport_layer, const uint8_t* data, const size_t size)
+    {
+        uint8_t payload[256];
+        size_t offset = 0;
+        port.reset();
+
+        // Each ReceiveData() call consumes at least one byte while the port has enough bytes to hold a packet, so the
+        // loop always terminates.
+        while (true)
+        {
+            offset += port.PushReceptionData(data + offset, size - offset);
+            if (!transport_layer.Available()) break;
+
+            if (!transport_layer.ReceiveData()) continue;
+
+            // Reads the entire received payload to exercise the payload size tracking.
+            const uint8_t payload_size = transport_layer.get_bytes_in_reception_buffer();
+            if (!transport_layer.ReadData(payload, payload_size)) __builtin_trap();
+        }
+    }
+
+    /// Stores the communication interface used by the 8-bit CRC TransportLayer instance.
+    CompactStreamMock<512> crc8_port;  // NOLINT(*-avoid-non-const-global-variables)
+
+    /// Stores the communication interface used by the 16-bit CRC TransportLayer instance with sequence numbers.
+    CompactStreamMock<512> crc16_port;  // NOLINT(*-avoid-non-const-global-variables)
+
+    /// Stores the communication interface used by the 32-bit CRC TransportLayer instance with small buffers.
+    CompactStreamMock<512> crc32_port;  // NOLINT(*-avoid-non-const-global-variables)
+
+    /// Uses the default TransportLayer configuration.
+    TransportLayer<uint8_t> crc8_transport(crc8_port);  // NOLINT(*-avoid-non-const-global-variables)
+
+    /// Uses a 16-bit CRC and 16-bit sequence numbers.
+    TransportLayer<uint16_t, 252, 252, 2> crc16_transport(  // NOLINT(*-avoid-non-const-global-variables)
+        crc16_port,
+        0x1021,
+        0xFFFF,
+        0x0000
+    );
+
+    /// Uses a 32-bit CRC and reduced reception buffer, which exercises the payload size range check.
+    TransportLayer<uint32_t, 64, 32> crc32_transport(  // NOLINT(*-avoid-non-const-global-variables)
+        crc32_port,
+        0x04C11DB7,
+        0xFFFFFFFF,
+        0xFFFFFFFF
+    );
+}  // namespace
+
+/// Runs the fuzzer-generated byte stream through all fuzzed TransportLayer configurations.
+extern "C" int LLVMFuzzerTestOneInput(const uint8_t* data, const size_t size)
+{
+    ReceiveStream(crc8_port, crc8_transport, data, size);
+    ReceiveStream(crc16_port, crc16_transport, data, size);
+    ReceiveStream(crc32_port, crc32_transport, data, size);
+    return 0;
+}
+
+#if defined(AXTLMC_FUZZ_STANDALONE)
+#include "standalone_driver.h"
+#endif
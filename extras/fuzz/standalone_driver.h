@@ -0,0 +1,67 @@
+/**
+ * @file
+ *
+ * @brief Provides the main() function that replays fuzzer inputs stored in files when the fuzzing harnesses are
+ * built without libFuzzer.
+ *
+ * @note Each command-line argument is read as a single fuzzer input. When no arguments are provided, the driver
+ * instead runs the harness on a fixed number of pseudo-random inputs, which is useful as a smoke test.
+ */
+
+#ifndef AXTLMC_FUZZ_STANDALONE_DRIVER_H
+#define AXTLMC_FUZZ_STANDALONE_DRIVER_H
+
+#include <cstdio>
+#include <vector>
+
+extern "C" int LLVMFuzzerTestOneInput(const uint8_t* data, size_t size);
+
+int main(const int argc, char** argv)
+{
+    // Replays the input files.
+    if (argc > 1)
+    {
+        for (int i = 1; i < argc; i++)
+        {
+            FILE* file = fopen(argv[i], "rb");
+            if (file == nullptr)
+            {
+                fprintf(stderr, "Unable to open %s\n", argv[i]);
+                return 1;
+            }
+
+            std::vector<uint8_t> input;
+            uint8_t chunk[4096];
+            size_t chunk_size;
+            while ((chunk_size = fread(chunk, 1, sizeof(chunk), file)) > 0)
+            {
+                input.insert(input.end(), chunk, chunk + chunk_size);
+            }
+            fclose(file);
+
+            LLVMFuzzerTestOneInput(input.data(), input.size());
+        }
+        return 0;
+    }
+
+    // Generates pseudo-random inputs using the xorshift32 generator. Every other input starts with the start byte,
+    // so that the harness reaches the packet parsing stages reasonably often.
+    uint32_t state = 0x9E3779B9;
+    std::vector<uint8_t> input;
+    for (uint32_t iteration = 0; iteration < 5000; iteration++)
+    {
+        input.resize(1 + state % 600);
+        for (uint8_t& value : input)
+        {
+            state ^= state << 13;
+            state ^= state >> 17;
+            state ^= state << 5;
+            value = static_cast<uint8_t>(state);
+        }
+        if (iteration % 2 == 0) input[0] = 129;
+        LLVMFuzzerTestOneInput(input.data(), input.size());
+    }
+    return 0;
+}
+
+#endif  //AXTLMC_FUZZ_STANDALONE_DRIVER_H
@@ -0,0 +1,126 @@
+/**
+ * @file
+ *
+ * @brief Provides the minimal subset of the Arduino core API used by the library, so that the library headers can be
+ * compiled and exercised on the host PC.
+ *
+ * @section host_description Description:
+ * This header is part of the host shim used by the fuzzing harnesses and the native (PC) tests. It is never compiled
+ * for the microcontroller targets, which use the real Arduino core headers instead.
+ *
+ * @note By default, the timing functions use the host's monotonic clock. Defining AXTLMC_HOST_VIRTUAL_CLOCK before
+ * including this header switches them to a virtual clock that advances by AXTLMC_HOST_VIRTUAL_CLOCK_STEP microseconds
+ * (100 by default, roughly the time it takes to transmit one byte at 115200 baud) on every query. This makes all
+ * busy-wait timeouts deterministic and fast, which is required for fuzzing.
+ */
+
+#ifndef AXTLMC_HOST_ARDUINO_H
+#define AXTLMC_HOST_ARDUINO_H
+
+/// Marks the build as a host PC build, which the library headers use to select the host-specific configuration.
+#define AXTLMC_HOST_SHIM
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <thread>
+#include <type_traits>
+
+/// Returns the smaller of the two input values.
+template <typename A, typename B>
+constexpr std::common_type_t<A, B> min(const A a, const B b)
+{
+    return a < b ? a : b;
+}
+
+/// Returns the larger of the two input values.
+template <typename A, typename B>
+constexpr std::common_type_t<A, B> max(const A a, const B b)
+{
+    return a > b ? a : b;
+}
+
+#if defined(AXTLMC_HOST_VIRTUAL_CLOCK)
+
+#if !defined(AXTLMC_HOST_VIRTUAL_CLOCK_STEP)
+#define AXTLMC_HOST_VIRTUAL_CLOCK_STEP 100
+#endif
+
+/// Stores the current value of the virtual clock, in microseconds.
+inline uint32_t host_virtual_clock = 0;  // NOLINT(*-avoid-non-const-global-variables)
+
+/// Returns the number of microseconds elapsed since the virtual clock was started and advances the clock.
+inline uint32_t micros()
+{
+    const uint32_t now = host_virtual_clock;
+    host_virtual_clock += AXTLMC_HOST_VIRTUAL_CLOCK_STEP;
+    return now;
+}
+
+/// Returns the number of milliseconds elapsed since the virtual clock was started and advances the clock.
+inline uint32_t millis()
+{
+    return micros() / 1000;
+}
+
+/// Advances the virtual clock by the requested number of milliseconds.
+inline void delay(const uint32_t duration)
+{
+    host_virtual_clock += duration * 1000;
+}
+
+/// Advances the virtual clock by the requested number of microseconds.
+inline void delayMicroseconds(const uint32_t duration)
+{
+    host_virtual_clock += duration;
+}
+
+#else
+
+/// Returns the number of microseconds elapsed since the first call to any timing function.
+inline uint32_t micros()
+{
+    static const auto start = std::chrono::steady_clock::now();
+    return static_cast<uint32_t>(
+        std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count()
+    );
+}
+
+/// Returns the number of milliseconds elapsed since the first call to any timing function.
+inline uint32_t millis()
+{
+    return micros() / 1000;
+}
+
+/// Blocks the calling thread for the requested number of milliseconds.
+inline void delay(const uint32_t duration)
+{
+    std::this_thread::sleep_for(std::chrono::milliseconds(duration));
+}
+
+/// Blocks the calling thread for the requested number of microseconds.
+inline void delayMicroseconds(const uint32_t duration)
+{
+    std::this_thread::sleep_for(std::chrono::microseconds(duration));
+}
+
+#endif
+
+/// Interrupts do not exist on the host, so the interrupt control functions do nothing.
+inline void noInterrupts()
+{}
+
+/// Interrupts do not exist on the host, so the interrupt control functions do nothing.
+inline void interrupts()
+{}
+
+// The host has a single flat address space, so program memory is accessed like any other memory.
+#define PROGMEM
+#define pgm_read_byte(address)  (*reinterpret_cast<const uint8_t*>(address))
+#define pgm_read_word(address)  (*reinterpret_cast<const uint16_t*>(address))
+#define pgm_read_dword(address) (*reinterpret_cast<const uint32_t*>(address))
+
+#include "Stream.h"
+
+#endif  //AXTLMC_HOST_ARDUINO_H
@@ -0,0 +1,74 @@
+/**
+ * @file
+ *
+ * @brief Provides the host versions of the Arduino Print and Stream interfaces used by the library.
+ */
+
+#ifndef AXTLMC_HOST_STREAM_H
+#define AXTLMC_HOST_STREAM_H
+
+#include <cstddef>
+#include <cstdint>
+
+/// Mirrors the Arduino Print class interface used by the library.
+class Print
+{
+    public:
+        virtual ~Print() = default;
+
+        /// Writes a single byte to the interface and returns the number of written bytes.
+        virtual size_t write(uint8_t value) = 0;
+
+        /// Writes the requested number of bytes to the interface and returns the number of written bytes.
+        virtual size_t write(const uint8_t* buffer, const size_t size)
+        {
+            size_t bytes_written = 0;
+            while (bytes_written < size && write(buffer[bytes_written]) == 1) bytes_written++;
+            return bytes_written;
+        }
+
+        /// Returns the number of bytes that can be written to the interface without blocking.
+        virtual int availableForWrite()
+        {
+            return 0;
+        }
+
+        /// Waits until all written bytes are transmitted.
+        virtual void flush()
+        {}
+};
+
+/// Mirrors the Arduino Stream class interface used by the library.
+class Stream : public Print
+{
+    public:
+        /// Returns the number of bytes available for reading.
+        virtual int available() = 0;
+
+        /// Reads and returns the next available byte, or -1 if no bytes are available.
+        virtual int read() = 0;
+
+        /// Returns the next available byte without consuming it, or -1 if no bytes are available.
+        virtual int peek() = 0;
+
+        /// Reads up to the requested number of bytes into the input buffer and returns the number of read bytes.
+        size_t readBytes(char* buffer, const size_t length)
+        {
+            size_t bytes_read = 0;
+            while (bytes_read < length)
+            {
+                const int value = read();
+                if (value < 0) break;
+                buffer[bytes_read++] = static_cast<char>(value);
+            }
+            return bytes_read;
+        }
+
+        /// Reads up to the requested number of bytes into the input buffer and returns the number of read bytes.
+        size_t readBytes(uint8_t* buffer, const size_t length)
+        {
+            return readBytes(reinterpret_cast<char*>(buffer), length);
+        }
+};
+
+#endif  //AXTLMC_HOST_STREAM_H
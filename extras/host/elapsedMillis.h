@@ -0,0 +1,56 @@
+/**
+ * @file
+ *
+ * @brief Provides the host versions of the elapsedMicros and elapsedMillis timer classes used by the library.
+ */
+
+#ifndef AXTLMC_HOST_ELAPSED_MILLIS_H
+#define AXTLMC_HOST_ELAPSED_MILLIS_H
+
+#include "Arduino.h"
+
+/// Tracks the number of microseconds elapsed since the timer was last reset.
+class elapsedMicros
+{
+    public:
+        elapsedMicros(const uint32_t value = 0) : _start(micros() - value)  // NOLINT(*-explicit-constructor)
+        {}
+
+        operator uint32_t() const  // NOLINT(*-explicit-constructor)
+        {
+            return micros() - _start;
+        }
+
+        elapsedMicros& operator=(const uint32_t value)
+        {
+            _start = micros() - value;
+            return *this;
+        }
+
+    private:
+        uint32_t _start;
+};
+
+/// Tracks the number of milliseconds elapsed since the timer was last reset.
+class elapsedMillis
+{
+    public:
+        elapsedMillis(const uint32_t value = 0) : _start(millis() - value)  // NOLINT(*-explicit-constructor)
+        {}
+
+        operator uint32_t() const  // NOLINT(*-explicit-constructor)
+        {
+            return millis() - _start;
+        }
+
+        elapsedMillis& operator=(const uint32_t value)
+        {
+            _start = millis() - value;
+            return *this;
+        }
+
+    private:
+        uint32_t _start;
+};
+
+#endif  //AXTLMC_HOST_ELAPSED_MILLIS_H
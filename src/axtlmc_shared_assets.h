@@ -51,28 +51,268 @@ namespace axtlmc_shared_assets
         kDelimiterNotFoundError      = 25,  ///< Delimiter byte was not found at the end of the packet.
         kDelimiterFoundTooEarlyError = 26,  ///< Delimiter byte was found before reaching the end of the packet.
         kPostambleTimeoutError       = 27,  ///< The Postamble was not received within the specified time frame.
+        kPacketEncoded               = 28,  ///< The packet was constructed and copied into the destination buffer.
+        kEncodedDataBufferError      = 29,  ///< The destination buffer is too small to store the constructed packet.
+        kEncodedDataPartiallySent    = 30,  ///< Only a part of the constructed packet data was transmitted.
+        kInvalidGatheredPayloadSize  = 31,  ///< The combined size of the gathered data segments is not valid.
+        kPolynomialMismatch          = 32,  ///< The checksum engine cannot use the requested CRC polynomial.
     };
 
     /**
-     * @struct kBufferLayout
+     * @enum kReliableChannelStatusCodes
+     * @brief Defines the codes used by the ReliableChannel class to indicate the status of all supported data
+     * manipulations.
+     */
+    enum class kReliableChannelStatusCodes : uint8_t
+    {
+        kStandby                  = 51,  ///< The value used to initialize the status tracker variable.
+        kPacketSent               = 52,  ///< Reliable packet was transmitted and added to the retransmission window.
+        kRetransmissionWindowFull = 53,  ///< All retransmission window slots store unacknowledged packets.
+        kPacketReceived           = 54,  ///< New reliable packet was received and acknowledged.
+        kDuplicatePacketReceived  = 55,  ///< Already received reliable packet was discarded and re-acknowledged.
+        kAcknowledgementReceived  = 56,  ///< Acknowledgement packet was received and processed.
+        kUnexpectedPacketReceived = 57,  ///< Received packet does not use the reliable channel format or window.
+        kNoPacketReceived         = 58,  ///< No packet was received, the underlying TransportLayer status is kept.
+    };
+
+    /**
+     * @enum kReceptionQueueStatusCodes
+     * @brief Defines the codes used by the ReceptionQueue class to indicate the status of all supported data
+     * manipulations.
+     */
+    enum class kReceptionQueueStatusCodes : uint8_t
+    {
+        kStandby              = 61,  ///< The value used to initialize the status tracker variable.
+        kPacketsQueued        = 62,  ///< At least one received packet was added to the queue.
+        kNoPacketsQueued      = 63,  ///< No packet was received, the underlying TransportLayer status is kept.
+        kQueueOverflow        = 64,  ///< At least one packet was dropped because the queue was full.
+        kQueueEmpty           = 65,  ///< The queue does not contain any packets.
+        kReadObjectQueueError = 66,  ///< Not enough bytes in the queued payload to read the object from.
+        kPacketPeeked         = 67,  ///< The object has been read from the oldest queued packet.
+        kPacketPopped         = 68,  ///< The oldest queued packet has been removed from the queue.
+    };
+
+    /**
+     * @enum kTransmissionQueueStatusCodes
+     * @brief Defines the codes used by the TransmissionQueue class to indicate the status of all supported data
+     * manipulations.
+     */
+    enum class kTransmissionQueueStatusCodes : uint8_t
+    {
+        kStandby          = 71,  ///< The value used to initialize the status tracker variable.
+        kPacketQueued     = 72,  ///< The staged payload was encoded into a packet and added to the queue.
+        kQueueFull        = 73,  ///< The queue does not have enough free space to store another packet.
+        kQueueDrained     = 74,  ///< All queued bytes were written to the communication interface.
+        kPartiallyDrained = 75,  ///< Some queued bytes were written to the communication interface.
+        kInterfaceBusy    = 76,  ///< The communication interface could not accept any queued bytes.
+    };
+
+    /**
+     * @enum kInterruptReceiverStatusCodes
+     * @brief Defines the codes used by the InterruptReceiver class to indicate the status of all supported data
+     * manipulations.
+     */
+    enum class kInterruptReceiverStatusCodes : uint8_t
+    {
+        kStandby         = 81,  ///< The value used to initialize the status tracker variable.
+        kPacketReceived  = 82,  ///< The oldest framed packet was validated and decoded by the TransportLayer instance.
+        kPacketRejected  = 83,  ///< The oldest framed packet failed validation, the TransportLayer status has details.
+        kNoPacketsFramed = 84,  ///< The queue does not contain any framed packets.
+    };
+
+    /**
+     * @enum kStreamingReceiverStatusCodes
+     * @brief Defines the codes used by the StreamingReceiver class to indicate the status of all supported data
+     * manipulations.
+     */
+    enum class kStreamingReceiverStatusCodes : uint8_t
+    {
+        kStandby         = 91,  ///< The value used to initialize the status tracker variable.
+        kPacketReceived  = 92,  ///< The framed packet was validated and decoded by the TransportLayer instance.
+        kPacketRejected  = 93,  ///< The framed packet failed validation, the TransportLayer status has details.
+        kNoPacketsFramed = 94,  ///< The accumulated bytes do not contain a complete packet.
+        kBufferOverflow  = 95,  ///< The accumulated bytes filled the buffer without completing a packet.
+    };
+
+    /**
+     * @enum kCompressedChannelStatusCodes
+     * @brief Defines the codes used by the CompressedChannel class to indicate the status of all supported data
+     * manipulations.
+     */
+    enum class kCompressedChannelStatusCodes : uint8_t
+    {
+        kStandby                = 101,  ///< The value used to initialize the status tracker variable.
+        kPacketSent             = 102,  ///< The staged payload was compressed and transmitted.
+        kPacketReceived         = 103,  ///< The received payload was decompressed and is available for reading.
+        kNoPacketReceived       = 104,  ///< No packet was received, the underlying TransportLayer status is kept.
+        kDecompressionFailed    = 105,  ///< The received payload uses an unknown or malformed compression format.
+        kWriteObjectBufferError = 106,  ///< The staged payload lacks space for the written object.
+        kReadObjectBufferError  = 107,  ///< The received payload has fewer unread bytes than the read object.
+    };
+
+    /**
+     * @enum kQueueOverflowPolicies
+     * @brief Defines the policies used by the ReceptionQueue class to resolve packet queue overflows.
+     */
+    enum class kQueueOverflowPolicies : uint8_t
+    {
+        kDropOldest = 0,  ///< Discards the oldest queued packet to make space for the newly received packet.
+        kDropNewest = 1,  ///< Discards the newly received packet and keeps all queued packets.
+    };
+
+    /**
+     * @enum kCompressionMethods
+     * @brief Defines the methods used by the CompressionProcessor class to compress the payloads. The method is stored
+     * in the lower bits of the compression header byte that precedes each compressed payload.
+     */
+    enum class kCompressionMethods : uint8_t
+    {
+        kNone      = 0,  ///< The payload is stored without compression.
+        kRunLength = 1,  ///< The runs of repeated bytes are replaced with the byte value and the run length.
+        kDelta     = 2,  ///< The 16-bit samples are replaced with the zigzag varint-encoded sample differences.
+    };
+
+    /**
+     * @struct PacketLayout
      * @brief Stores the parameters that jointly define the layout and constraints for the data buffers processed by
      * this library.
      *
-     * The parameters from this structure are used by all classes exposed by the library to determine how to interact
-     * with the input data buffers.
+     * The layout is used as a compile-time policy by the TransportLayer class and the COBSProcessor and CRCProcessor
+     * methods, so each layout variant is compiled into its own specialized code without any runtime checks. The
+     * layouts that transmit the payload size share the same COBS-encoded frame: [OVERHEAD BYTE] [PAYLOAD] [DELIMITER
+     * BYTE] [CHECKSUM]. These layouts only differ in the preamble that precedes the frame and in the value used as the
+     * frame delimiter.
+     *
+     * The delimiter-framed layouts (kPayloadSizeFieldWidth of 0) transmit neither the start byte nor the payload size,
+     * which saves 2 bytes per packet on trusted links. Their packets only consist of the COBS-encoded frame
+     * [OVERHEAD BYTE] [PAYLOAD] [CHECKSUM] [DELIMITER BYTE], and the receiver infers the payload size from the position
+     * of the delimiter byte. The checksum is calculated over the unencoded payload and is encoded together with it, so
+     * every delimiter byte on the wire marks the end of a packet and the receiver resynchronizes with the packet
+     * stream right after any corrupted packet. Since the checksum occupies a part of the COBS frame, the payload size
+     * combined with the checksum size must not exceed 254 bytes.
+     *
+     * @note When the delimiter byte value is not 0, the COBS-encoded distances are XORed with the delimiter byte
+     * value, so the encoded frame never contains the delimiter byte before its end.
+     *
+     * @tparam kStartByteValue The value used as the packet start byte.
+     * @tparam kDelimiterByteValue The value used as the encoded packet delimiter.
+     * @tparam kUseStartByte Determines whether the packets begin with the start byte. Layouts without the start byte
+     * save one byte per packet, but the receiver can only resynchronize with the packet stream after the
+     * communication interface stays silent for longer than the inter-byte timeout.
+     * @tparam kPayloadSizeFieldWidth The width of the payload size field, in bytes. Valid values are 0, 1, and 2. The
+     * 2-byte field is stored in little-endian order and is intended for compatibility with peers that use 16-bit
+     * size fields. Since COBS limits the payloads to 254 bytes, its upper byte is always 0. A width of 0 selects the
+     * delimiter-framed layout, which requires kUseStartByte to be false.
      */
-    struct kBufferLayout
+    template <
+        const uint8_t kStartByteValue        = 129,
+        const uint8_t kDelimiterByteValue    = 0,
+        const bool kUseStartByte             = true,
+        const uint8_t kPayloadSizeFieldWidth = 1>
+    struct PacketLayout
     {
+            static_assert(
+                kPayloadSizeFieldWidth <= 2,
+                "PacketLayout's kPayloadSizeFieldWidth template parameter must be 0, 1, or 2."
+            );
+            static_assert(
+                kPayloadSizeFieldWidth > 0 || !kUseStartByte,
+                "PacketLayout's delimiter-framed layouts (kPayloadSizeFieldWidth of 0) must not use the start byte."
+            );
+            static_assert(
+                !kUseStartByte || kStartByteValue != kDelimiterByteValue,
+                "PacketLayout's kStartByteValue and kDelimiterByteValue template parameters must be different."
+            );
+
             static constexpr uint8_t kMinimumPayloadSize = 1;    ///< Prevents sending or receiving empty payloads.
             static constexpr uint8_t kMaximumPayloadSize = 254;  ///< Caps the maximum size per COBS specification.
             static constexpr uint8_t kMinimumPacketSize  = 3;    ///< The smallest valid COBS-encoded packet, in bytes.
             static constexpr uint16_t kMaximumPacketSize = 256;  ///< The largest valid COBS-encoded packet, in bytes.
-            static constexpr uint8_t kDelimiterByte      = 0;    ///< The value used as the encoded packet delimiter.
-            static constexpr uint8_t kStartByte          = 129;  ///< The value used as the packet start byte.
-            static constexpr uint8_t kStartByteIndex     = 0;    ///< The index of the start byte value.
-            static constexpr uint8_t kPayloadSizeIndex   = 1;    ///< The index of the payload size value.
-            static constexpr uint8_t kOverheadByteIndex  = 2;    ///< The index of the overhead byte value.
-            static constexpr uint8_t kPayloadStartIndex  = 3;    ///< The index of the first payload's data byte.
+            static constexpr uint8_t kDelimiterByte      = kDelimiterByteValue;     ///< The encoded packet delimiter.
+            static constexpr uint8_t kStartByte          = kStartByteValue;         ///< The packet start byte value.
+            static constexpr bool kHasStartByte          = kUseStartByte;           ///< Whether the start byte is used.
+            static constexpr uint8_t kPayloadSizeWidth   = kPayloadSizeFieldWidth;  ///< The size field width, in bytes.
+            static constexpr bool kIsDelimiterFramed     = kPayloadSizeFieldWidth == 0;  ///< Whether size is inferred.
+            static constexpr uint8_t kStartByteIndex     = 0;  ///< The index of the start byte value, if it is used.
+
+            /// The index of the payload size value. For 2-byte size fields, this is the index of the lower byte. The
+            /// delimiter-framed layouts keep the payload size at this index of the staging buffers, but do not transmit
+            /// it.
+            static constexpr uint8_t kPayloadSizeIndex = kUseStartByte ? 1 : 0;
+
+            /// The index of the overhead byte value. This is also the number of staging buffer bytes that precede the
+            /// COBS frame.
+            static constexpr uint8_t kOverheadByteIndex =
+                kPayloadSizeIndex + (kPayloadSizeFieldWidth > 0 ? kPayloadSizeFieldWidth : 1);
+
+            /// The index of the first payload's data byte.
+            static constexpr uint8_t kPayloadStartIndex = kOverheadByteIndex + 1;
+
+            /// The index of the first transmitted byte of the packet inside the staging buffers.
+            static constexpr uint8_t kPacketStartIndex = kPayloadSizeFieldWidth > 0 ? 0 : kOverheadByteIndex;
+    };
+
+    /// The default packet layout: [START BYTE 129] [8-BIT PAYLOAD SIZE] [COBS FRAME DELIMITED BY 0].
+    using kBufferLayout = PacketLayout<>;
+
+    /// The delimiter-framed packet layout: [COBS FRAME THAT STORES THE PAYLOAD AND THE CHECKSUM, DELIMITED BY 0].
+    using kDelimitedLayout = PacketLayout<129, 0, false, 0>;
+
+    /**
+     * @struct kReservedPacketTypes
+     * @brief Stores the packet type codes reserved for the packets generated by the library's diagnostic tools.
+     *
+     * The packet type code is the first byte of the packet's payload. Application packets that use the same convention
+     * must not use the reserved codes.
+     */
+    struct kReservedPacketTypes
+    {
+            static constexpr uint8_t kLatencyHistogram = 250;  ///< The packet stores a LatencyHistogram instance.
+            static constexpr uint8_t kTelemetry        = 251;  ///< The packet stores the TransportLayer telemetry.
+    };
+
+    /**
+     * @struct SequenceStatistics
+     * @brief Stores the counters used by the TransportLayer class to track the sequence numbers of the received
+     * packets.
+     *
+     * The counters are only updated by TransportLayer instances configured to use the sequence number header
+     * extension. Together, they allow estimating the real packet loss rate of the communication link as
+     * missing_packets / (received_packets + missing_packets).
+     */
+    struct SequenceStatistics
+    {
+            uint32_t received_packets  = 0;  ///< The number of valid packets received with a sequence number.
+            uint32_t missing_packets   = 0;  ///< The number of skipped sequence numbers that were never received.
+            uint32_t duplicate_packets = 0;  ///< The number of packets whose sequence number was already received.
+            uint32_t reordered_packets = 0;  ///< The number of packets that arrived after a newer packet.
+    };
+
+    /**
+     * @struct LinkStatistics
+     * @brief Stores the counters used by the TransportLayer class to track the health of the communication link.
+     */
+    struct LinkStatistics
+    {
+            uint32_t transmitted_packets        = 0;  ///< The number of packets transmitted by the SendData() methods.
+            uint32_t received_packets           = 0;  ///< The number of packets received and decoded successfully.
+            uint32_t checksum_errors            = 0;  ///< The number of received packets with invalid checksums.
+            uint32_t timeout_errors             = 0;  ///< The number of received packets abandoned due to stalling.
+            uint32_t framing_errors             = 0;  ///< The number of received packets with invalid framing or COBS.
+            uint16_t reception_backlog_peak     = 0;  ///< The most bytes waiting to be parsed by ReceiveData().
+            uint8_t largest_received_payload    = 0;  ///< The size of the largest received payload, in bytes.
+            uint8_t largest_transmitted_payload = 0;  ///< The size of the largest transmitted payload, in bytes.
+    };
+
+    /**
+     * @struct DataSegment
+     * @brief Describes a contiguous memory region that stores a part of the payload gathered into a single packet by
+     * the TransportLayer class's scatter-gather SendData() method.
+     */
+    struct DataSegment
+    {
+            const void* data = nullptr;  ///< The pointer to the first byte of the memory region.
+            uint16_t size    = 0;        ///< The size of the memory region, in bytes.
     };
 
     // Reimplements standard library type traits for compatibility with Arduino Mega boards, which lack the
@@ -118,6 +358,98 @@ namespace axtlmc_shared_assets
      */
     template <typename T, typename U>
     constexpr bool is_same_v = is_same<T, U>::value;  // NOLINT(*-dynamic-static-initializers)
+
+    /**
+     * @brief Provides the CRC polynomial used by the input checksum engine or CRC kernel type when the caller does not
+     * specify the polynomial.
+     *
+     * Defaults to 0x07 for the types whose polynomial is provided at runtime.
+     *
+     * @tparam T The checksum engine or CRC kernel type.
+     * @tparam PolynomialType The datatype of the CRC polynomial.
+     */
+    template <typename T, typename PolynomialType, typename = void>
+    struct default_polynomial
+    {
+            /// The polynomial used when the caller does not specify the polynomial.
+            static constexpr PolynomialType value = 0x07;
+    };
+
+    /**
+     * @brief Specializes the 'default_polynomial' structure for the types that declare a kDefaultPolynomial member,
+     * such as the types that generate their CRC lookup table for a compile-time polynomial.
+     *
+     * @tparam T The checksum engine or CRC kernel type.
+     * @tparam PolynomialType The datatype of the CRC polynomial.
+     */
+    template <typename T, typename PolynomialType>
+    struct default_polynomial<T, PolynomialType, decltype(static_cast<void>(T::kDefaultPolynomial))>
+    {
+            /// The polynomial used when the caller does not specify the polynomial.
+            static constexpr PolynomialType value = T::kDefaultPolynomial;
+    };
+
+    /**
+     * @brief Reads the variable shared between the interrupt (or thread) that writes it and the code that reads it.
+     *
+     * The read is ordered after all memory accesses that precede the matching StoreRelease() call in the writing
+     * context. Single-byte variables are read atomically on all supported boards. Since 8-bit AVR boards cannot read
+     * wider variables atomically, on these boards the variable is re-read until two consecutive reads match, which
+     * requires the variable to only be written from an interrupt service routine.
+     *
+     * @tparam ValueType The datatype of the shared variable.
+     * @param value The shared variable to read.
+     * @returns the value of the shared variable.
+     */
+    template <typename ValueType>
+    ValueType LoadAcquire(const ValueType& value)
+    {
+#if defined(__AVR__)
+        if constexpr (sizeof(ValueType) > 1)
+        {
+            const volatile ValueType& shared = value;
+            ValueType result                 = shared;
+            ValueType previous;
+            do
+            {
+                previous = result;
+                result   = shared;
+            } while (result != previous);
+            __atomic_signal_fence(__ATOMIC_ACQUIRE);
+            return result;
+        }
+        else
+#endif
+        {
+            return __atomic_load_n(&value, __ATOMIC_ACQUIRE);
+        }
+    }
+
+    /**
+     * @brief Writes the variable shared between the interrupt (or thread) that writes it and the code that reads it.
+     *
+     * All memory accesses that precede this call are made visible to the context that reads the new value with the
+     * LoadAcquire() function.
+     *
+     * @tparam ValueType The datatype of the shared variable.
+     * @param variable The shared variable to write.
+     * @param value The value to write to the shared variable.
+     */
+    template <typename ValueType>
+    void StoreRelease(ValueType& variable, const ValueType value)
+    {
+#if defined(__AVR__)
+        if constexpr (sizeof(ValueType) > 1)
+        {
+            __atomic_signal_fence(__ATOMIC_RELEASE);
+            *static_cast<volatile ValueType*>(&variable) = value;
+        }
+        else
+#endif
+        {
+            __atomic_store_n(&variable, value, __ATOMIC_RELEASE);
+        }
+    }
 }  // namespace axtlmc_shared_assets
 
 #endif  //AXTLMC_SHARED_ASSETS_H
@@ -35,50 +35,52 @@ class COBSProcessor final
          * @note This method performs no bounds checking. The payload size stored at the payload-size index must be
          * within the valid range, and the buffer must have room for the appended overhead and delimiter bytes.
          *
+         * @tparam LayoutType the PacketLayout of the input buffer. Defaults to the library's default layout.
          * @tparam kBufferSize the size of the input buffer array, in bytes.
          * @param buffer the buffer that stores the payload data to be encoded.
          *
          * @returns the size of the encoded packet, in bytes.
          */
-        template <const size_t kBufferSize>
+        template <typename LayoutType = kBufferLayout, const size_t kBufferSize>
         static uint16_t EncodePayload(uint8_t (&buffer)[kBufferSize])
         {
             // Extracts the payload size from the buffer's payload-size byte.
-            const uint8_t payload_size = buffer[kBufferLayout::kPayloadSizeIndex];
+            const uint8_t payload_size = buffer[LayoutType::kPayloadSizeIndex];
 
             // Determines start and end indices for the loop below based on the requested payload_size. Transforms the
             // indices to be buffer-centric and account for the prepended metadata bytes.
-            const uint16_t payload_end_index = payload_size + kBufferLayout::kOverheadByteIndex;  // INCLUSIVE end index
+            const uint16_t payload_end_index = payload_size + LayoutType::kOverheadByteIndex;  // INCLUSIVE end index
 
             // Since payload_end_index is inclusive, the delimiter index immediately follows the value of that variable.
             const uint16_t delimiter_index = payload_end_index + 1;
 
             // Appends the delimiter byte to the end of the payload buffer.
-            buffer[delimiter_index] = kBufferLayout::kDelimiterByte;
+            buffer[delimiter_index] = LayoutType::kDelimiterByte;
 
             // Tracks the discovered delimiter byte indices during the loop below to support iterative COBS
             // encoding.
             uint16_t last_delimiter_index = 0;
 
             // Loops over the requested payload size in reverse and encodes all instances of the delimiter byte
-            // using the COBS scheme.
-            for (uint16_t index = payload_end_index; index >= kBufferLayout::kPayloadStartIndex; --index)
+            // using the COBS scheme. The encoded distances are XORed with the delimiter byte value, which has no effect
+            // for the default 0-valued delimiter and keeps the encoded values distinct from any other delimiter value.
+            for (uint16_t index = payload_end_index; index >= LayoutType::kPayloadStartIndex; --index)
             {
-                if (buffer[index] == kBufferLayout::kDelimiterByte)
+                if (buffer[index] == LayoutType::kDelimiterByte)
                 {
                     if (last_delimiter_index == 0)
                     {
                         // If a delimiter byte is encountered and last_delimiter_index is still set to the default
                         // value of 0, computes the distance from the current index to the end of the payload + 1,
                         // which is the distance to the delimiter byte appended to the end of the payload.
-                        buffer[index] = delimiter_index - index;
+                        buffer[index] = (delimiter_index - index) ^ LayoutType::kDelimiterByte;
                     }
                     else
                     {
                         // If last_delimiter_index is set to a non-0 value, uses it to calculate the distance from the
                         // current index to the last (encoded) delimiter byte value and overwrites the variable with
                         // that distance value.
-                        buffer[index] = last_delimiter_index - index;
+                        buffer[index] = (last_delimiter_index - index) ^ LayoutType::kDelimiterByte;
                     }
 
                     // Updates last_delimiter_index with the index of the last encoded variable
@@ -86,56 +88,128 @@ class COBSProcessor final
                 }
             }
 
-            // Once all delimiter bytes have been encoded, sets the overhead byte (index 2 of buffer) to store the
-            // distance to the closest encoded delimiter byte.
+            // Once all delimiter bytes have been encoded, sets the overhead byte to store the distance to the closest
+            // encoded delimiter byte.
             if (last_delimiter_index != 0)
             {
                 // Converts the absolute index of the closest encoded delimiter into its distance from the overhead
-                // byte located at index 2.
-                buffer[kBufferLayout::kOverheadByteIndex] = last_delimiter_index - kBufferLayout::kOverheadByteIndex;
+                // byte.
+                buffer[LayoutType::kOverheadByteIndex] =
+                    (last_delimiter_index - LayoutType::kOverheadByteIndex) ^ LayoutType::kDelimiterByte;
             }
             else
             {
                 // Calculates the distance from the overhead byte to the appended delimiter byte value, since no
                 // encoded delimiter bytes were found in the payload.
-                buffer[kBufferLayout::kOverheadByteIndex] = delimiter_index - kBufferLayout::kOverheadByteIndex;
+                buffer[LayoutType::kOverheadByteIndex] =
+                    (delimiter_index - LayoutType::kOverheadByteIndex) ^ LayoutType::kDelimiterByte;
             }
 
             // Returns the size of the COBS-encoded frame, accounting for the added overhead byte and delimiter byte.
             return payload_size + 2;
         }
 
+        /**
+         * @brief Overwrites a region of the COBS-encoded packet's payload with new data and re-encodes only the
+         * affected part of the packet.
+         *
+         * This method is used to update small fields inside packets that were encoded once and are transmitted many
+         * times. It follows the chain of encoded delimiter bytes from the overhead byte to the patched region and
+         * re-encodes the delimiter bytes inside the region, as well as the encoded delimiter byte (or the overhead
+         * byte) that immediately precedes it. The rest of the packet is not modified.
+         *
+         * @note This method performs no bounds checking. The patched region must be located entirely inside the
+         * payload of a valid COBS-encoded packet.
+         *
+         * @tparam LayoutType the PacketLayout of the input buffer. Defaults to the library's default layout.
+         * @tparam kBufferSize the size of the input buffer, in bytes.
+         * @param buffer the buffer that stores the COBS-encoded packet to patch.
+         * @param start_index the index of the first patched byte inside the buffer.
+         * @param data the pointer to the new (unencoded) data for the patched region.
+         * @param size the size of the patched region, in bytes.
+         * @param previous_value the variable that receives the original value of the encoded delimiter byte (or the
+         * overhead byte) that precedes the patched region. This is used to incrementally update the packet's checksum.
+         *
+         * @returns the index of the encoded delimiter byte (or the overhead byte) that precedes the patched region.
+         * Together with the patched region, this is the only byte whose value may be changed by this method.
+         */
+        template <typename LayoutType = kBufferLayout, const size_t kBufferSize>
+        static uint16_t PatchPayload(
+            uint8_t (&buffer)[kBufferSize],
+            const uint16_t start_index,
+            const uint8_t* data,
+            const uint16_t size,
+            uint8_t& previous_value
+        )
+        {
+            const uint16_t end_index = start_index + size;  // EXCLUSIVE end index
+
+            // Finds the last encoded delimiter byte (or the overhead byte) located before the patched region.
+            constexpr uint8_t kDelimiter = LayoutType::kDelimiterByte;
+            uint16_t previous_index      = LayoutType::kOverheadByteIndex;
+            while (previous_index + (buffer[previous_index] ^ kDelimiter) < start_index)
+            {
+                previous_index += buffer[previous_index] ^ kDelimiter;
+            }
+            previous_value = buffer[previous_index];
+
+            // Finds the first encoded delimiter byte (or the unencoded delimiter at the end of the packet) located
+            // after the patched region, skipping over the encoded delimiter bytes inside the region.
+            uint16_t next_index = previous_index + (buffer[previous_index] ^ kDelimiter);
+            while (next_index < end_index) next_index += buffer[next_index] ^ kDelimiter;
+
+            // Copies the new data into the patched region and re-encodes its delimiter bytes. The bytes between the
+            // preceding encoded delimiter and the patched region, and between the region and the next encoded
+            // delimiter, are never delimiter bytes, so they do not need to be re-encoded.
+            uint16_t last_delimiter_index = previous_index;
+            for (uint16_t i = 0; i < size; i++)
+            {
+                const uint16_t index = start_index + i;
+                buffer[index]        = data[i];
+                if (data[i] == kDelimiter)
+                {
+                    buffer[last_delimiter_index] = (index - last_delimiter_index) ^ kDelimiter;
+                    last_delimiter_index         = index;
+                }
+            }
+            buffer[last_delimiter_index] = (next_index - last_delimiter_index) ^ kDelimiter;
+
+            return previous_index;
+        }
+
         /**
          * @brief Uses the COBS scheme to decode the payload from the input packet in-place.
          *
          * @note A return value of 0 indicates packet corruption, whether the delimiter is encountered early or never
          * reached.
          *
+         * @tparam LayoutType the PacketLayout of the input buffer. Defaults to the library's default layout.
          * @tparam kBufferSize the size of the input buffer, in bytes.
          * @param buffer the buffer that stores the packet data from which to decode the payload.
          *
          * @returns the size of the decoded payload in bytes, or 0 if the method fails to decode the payload.
          */
-        template <const size_t kBufferSize>
+        template <typename LayoutType = kBufferLayout, const size_t kBufferSize>
         static uint16_t DecodePayload(uint8_t (&buffer)[kBufferSize])
         {
             // Extracts payload size and uses it to calculate the packet size by adding the overhead and delimiter
             // bytes to the payload size.
-            const uint8_t payload_size = buffer[kBufferLayout::kPayloadSizeIndex];
+            const uint8_t payload_size = buffer[LayoutType::kPayloadSizeIndex];
             const uint16_t packet_size = payload_size + 2;
 
             // Determines the expected index of the delimiter value
-            const uint16_t delimiter_index = packet_size + 1;
+            const uint16_t delimiter_index = packet_size + LayoutType::kOverheadByteIndex - 1;
 
             // Tracks the index inside the packet buffer read at each decoding cycle iteration.
-            uint16_t read_index = kBufferLayout::kOverheadByteIndex;
+            uint16_t read_index = LayoutType::kOverheadByteIndex;
 
             // Tracks distance to the next delimiter byte. Initializes to the value obtained from reading the
             // overhead byte, which points to the first (or only) occurrence of the delimiter byte in the packet.
-            auto next_index = static_cast<uint16_t>(buffer[read_index]);
+            auto next_index = static_cast<uint16_t>(buffer[read_index] ^ LayoutType::kDelimiterByte);
 
-            // Resets the overhead byte to 0 to indicate that the buffer has been through a decoding cycle
-            buffer[read_index] = 0;
+            // Resets the overhead byte to the delimiter byte value (0 for the default layout) to indicate that the
+            // buffer has been through a decoding cycle
+            buffer[read_index] = LayoutType::kDelimiterByte;
 
             // Increments the read_index to point either to the next encoded value or to the delimiter byte
             // found at the end of the packet.
@@ -145,7 +219,7 @@ class COBSProcessor final
             while (read_index <= delimiter_index)
             {
                 // Checks if the value obtained from read_index matches the packet delimiter value
-                if (buffer[read_index] == kBufferLayout::kDelimiterByte)
+                if (buffer[read_index] == LayoutType::kDelimiterByte)
                 {
                     // If the read_index matches the delimiter_index, returns the size of the decoded payload as
                     // decoding is complete.
@@ -161,10 +235,10 @@ class COBSProcessor final
 
                 // If the loop has not been broken, updates next_index with the next jump distance by reading the
                 // value of the encoded variable
-                next_index = buffer[read_index];
+                next_index = buffer[read_index] ^ LayoutType::kDelimiterByte;
 
                 // Restores the original delimiter byte (decodes the variable value)
-                buffer[read_index] = kBufferLayout::kDelimiterByte;
+                buffer[read_index] = LayoutType::kDelimiterByte;
 
                 // Jumps to the next encoded delimiter byte's position by distance aggregation.
                 read_index += next_index;
@@ -0,0 +1,264 @@
+/**
+ * @file
+ *
+ * @brief Provides the CompressedChannel class that compresses the payloads sent through the TransportLayer class and
+ * decompresses the received payloads.
+ *
+ * @section cc_description Description:
+ * On slow serial links, such as 115200-baud UART interfaces, the number of transmitted bytes limits the packet rate.
+ * The CompressedChannel class wraps a TransportLayer instance and compresses each staged payload with the
+ * CompressionProcessor class before the payload is COBS-encoded and transmitted. The received payloads are
+ * decompressed after they are decoded and verified by the TransportLayer instance. Each packet uses the compression
+ * method that produces the smallest payload, so the payloads that do not compress well are sent without compression at
+ * the cost of a single header byte.
+ *
+ * @section cc_packet_anatomy Payload Anatomy:
+ * The channel prepends the 1-byte compression header to the compressed payload of each TransportLayer packet it sends:
+ * [COMPRESSION HEADER] [COMPRESSED PAYLOAD]
+ *
+ * See the CompressionProcessor class for the description of the compression header and methods.
+ *
+ * @warning The instance reserves the wrapped TransportLayer instance's maximum transmitted and received payload sizes
+ * of RAM to stage the uncompressed payloads. On boards with limited RAM, such as Arduino Mega, reduce the
+ * TransportLayer's payload size template parameters accordingly.
+ */
+
+#ifndef AXTLMC_COMPRESSED_CHANNEL_H
+#define AXTLMC_COMPRESSED_CHANNEL_H
+
+#include <Arduino.h>
+#include "axtlmc_shared_assets.h"
+#include "compression_processor.h"
+
+using namespace axtlmc_shared_assets;
+
+/**
+ * @brief Compresses the payloads sent through the wrapped TransportLayer instance and decompresses the received
+ * payloads.
+ *
+ * @tparam TransportType The type of the wrapped TransportLayer instance.
+ */
+template <typename TransportType>
+class CompressedChannel final
+{
+        // Ensures that the wrapped TransportLayer instance can transmit and receive the compression header together
+        // with at least 1 payload byte.
+        static_assert(
+            TransportType::get_maximum_transmitted_payload_size() >= 2 &&
+                TransportType::get_maximum_received_payload_size() >= 2,
+            "CompressedChannel requires the wrapped TransportLayer's kMaximumTransmittedPayloadSize and "
+            "kMaximumReceivedPayloadSize template parameters to be at least 2."
+        );
+
+    public:
+        /**
+         * @brief Initializes the instance's payload buffers.
+         *
+         * @param transport_layer The TransportLayer instance used to send and receive the channel's packets. The
+         * channel must be the only user of this TransportLayer instance.
+         */
+        explicit CompressedChannel(TransportType& transport_layer) : _transport(transport_layer)
+        {}
+
+        /**
+         * @brief Serializes and writes the input object's data to the end of the uncompressed payload staged for the
+         * next packet.
+         *
+         * @tparam ObjectType The datatype of the object to write to the payload.
+         * @param object The object to write to the payload.
+         * @param object_size The size of the object, in bytes.
+         * @returns true if the object's data was written to the payload, or false if the payload lacks space for the
+         * object (the runtime status is set to kWriteObjectBufferError).
+         */
+        template <typename ObjectType>
+        bool WriteData(const ObjectType& object, const uint16_t object_size = sizeof(ObjectType))
+        {
+            if (_transmitted_size + object_size > kMaximumTransmittedPayloadSize)
+            {
+                _runtime_status = static_cast<uint8_t>(kCompressedChannelStatusCodes::kWriteObjectBufferError);
+                return false;
+            }
+
+            memcpy(&_transmitted_payload[_transmitted_size], static_cast<const void*>(&object), object_size);
+            _transmitted_size += object_size;
+            return true;
+        }
+
+        /**
+         * @brief Overwrites the input object's data with the data from the decompressed payload of the most recently
+         * received packet, consuming (discarding) all read bytes.
+         *
+         * @tparam ObjectType The datatype of the object to read from the payload.
+         * @param object The object to read from the payload.
+         * @param object_size The size of the object, in bytes.
+         * @returns true if the object's data was read from the payload, or false if fewer than object_size unread
+         * payload bytes remain (the runtime status is set to kReadObjectBufferError).
+         */
+        template <typename ObjectType>
+        bool ReadData(ObjectType& object, const uint16_t object_size = sizeof(ObjectType))
+        {
+            if (_consumed_size + object_size > _received_size)
+            {
+                _runtime_status = static_cast<uint8_t>(kCompressedChannelStatusCodes::kReadObjectBufferError);
+                return false;
+            }
+
+            memcpy(static_cast<void*>(&object), &_received_payload[_consumed_size], object_size);
+            _consumed_size += object_size;
+            return true;
+        }
+
+        /**
+         * @brief Compresses the staged payload and transmits it to the peer channel.
+         *
+         * The staged payload is discarded after it is transmitted.
+         *
+         * @returns true if the packet was transmitted and false otherwise.
+         */
+        bool SendData()
+        {
+            // The compressed payload is at most 1 byte larger than the uncompressed payload, so it always fits into
+            // the wrapped TransportLayer instance's payload.
+            uint8_t packet[kMaximumTransmittedPayloadSize + 1];
+            const uint16_t packet_size =
+                CompressionProcessor::Compress(_transmitted_payload, _transmitted_size, packet);
+
+            const DataSegment segments[] = {{packet, packet_size}};
+            if (!_transport.SendData(segments)) return false;
+
+            _uncompressed_bytes += _transmitted_size;
+            _compressed_bytes += packet_size;
+            _transmitted_size = 0;
+            _runtime_status   = static_cast<uint8_t>(kCompressedChannelStatusCodes::kPacketSent);
+            return true;
+        }
+
+        /**
+         * @brief Receives the next packet sent by the peer channel and decompresses its payload.
+         *
+         * Once this method returns true, the decompressed payload can be read using the ReadData() method.
+         *
+         * @returns true if a packet was received and decompressed and false otherwise.
+         */
+        bool ReceiveData()
+        {
+            if (!_transport.ReceiveData())
+            {
+                _runtime_status = static_cast<uint8_t>(kCompressedChannelStatusCodes::kNoPacketReceived);
+                return false;
+            }
+
+            uint8_t packet[TransportType::get_maximum_received_payload_size()];
+            const uint8_t packet_size = _transport.get_bytes_in_reception_buffer();
+            _transport.ReadData(packet, packet_size);
+
+            _received_size         = 0;
+            _consumed_size         = 0;
+            uint16_t received_size = 0;
+            if (!CompressionProcessor::Decompress(
+                    packet,
+                    packet_size,
+                    _received_payload,
+                    kMaximumReceivedPayloadSize,
+                    received_size
+                ))
+            {
+                _runtime_status = static_cast<uint8_t>(kCompressedChannelStatusCodes::kDecompressionFailed);
+                return false;
+            }
+
+            _received_size  = static_cast<uint8_t>(received_size);
+            _runtime_status = static_cast<uint8_t>(kCompressedChannelStatusCodes::kPacketReceived);
+            return true;
+        }
+
+        /// Returns the size of the uncompressed payload staged for the next packet, in bytes.
+        [[nodiscard]]
+        uint8_t get_bytes_in_transmission_buffer() const
+        {
+            return _transmitted_size;
+        }
+
+        /// Returns the size of the decompressed payload of the most recently received packet, in bytes.
+        [[nodiscard]]
+        uint8_t get_bytes_in_reception_buffer() const
+        {
+            return _received_size;
+        }
+
+        /// Returns the total number of uncompressed payload bytes sent through the channel.
+        [[nodiscard]]
+        uint32_t get_uncompressed_bytes() const
+        {
+            return _uncompressed_bytes;
+        }
+
+        /// Returns the total number of compressed payload bytes, including the compression headers, sent through the
+        /// channel.
+        [[nodiscard]]
+        uint32_t get_compressed_bytes() const
+        {
+            return _compressed_bytes;
+        }
+
+        /// Returns the largest uncompressed payload that can be sent through the channel, in bytes.
+        [[nodiscard]]
+        static constexpr uint8_t get_maximum_transmitted_payload_size()
+        {
+            return kMaximumTransmittedPayloadSize;
+        }
+
+        /// Returns the largest decompressed payload that can be received through the channel, in bytes.
+        [[nodiscard]]
+        static constexpr uint8_t get_maximum_received_payload_size()
+        {
+            return kMaximumReceivedPayloadSize;
+        }
+
+        /// Returns the runtime status of the most recently called method.
+        [[nodiscard]]
+        uint8_t get_runtime_status() const
+        {
+            return _runtime_status;
+        }
+
+    private:
+        /// Stores the largest uncompressed payload that can be sent through the channel. Reserves 1 byte of the
+        /// wrapped TransportLayer instance's payload for the compression header.
+        static constexpr uint8_t kMaximumTransmittedPayloadSize =
+            TransportType::get_maximum_transmitted_payload_size() - 1;
+
+        /// Stores the largest decompressed payload that can be received through the channel. Matches the largest
+        /// payload sent by a peer channel whose maximum transmitted payload size matches this instance's maximum
+        /// received payload size.
+        static constexpr uint8_t kMaximumReceivedPayloadSize = TransportType::get_maximum_received_payload_size() - 1;
+
+        /// The reference to the TransportLayer instance that sends and receives the channel's packets.
+        TransportType& _transport;
+
+        /// Stores the uncompressed payload staged for the next packet.
+        uint8_t _transmitted_payload[kMaximumTransmittedPayloadSize] {};
+
+        /// Stores the decompressed payload of the most recently received packet.
+        uint8_t _received_payload[kMaximumReceivedPayloadSize] {};
+
+        /// Stores the size of the staged uncompressed payload, in bytes.
+        uint8_t _transmitted_size = 0;
+
+        /// Stores the size of the decompressed payload, in bytes.
+        uint8_t _received_size = 0;
+
+        /// Stores the number of decompressed payload bytes consumed by the ReadData() method.
+        uint8_t _consumed_size = 0;
+
+        /// Tracks the total number of uncompressed payload bytes sent through the channel.
+        uint32_t _uncompressed_bytes = 0;
+
+        /// Tracks the total number of compressed payload bytes sent through the channel.
+        uint32_t _compressed_bytes = 0;
+
+        /// Stores the runtime status of the most recently called method.
+        uint8_t _runtime_status = static_cast<uint8_t>(kCompressedChannelStatusCodes::kStandby);
+};
+
+#endif  //AXTLMC_COMPRESSED_CHANNEL_H
@@ -0,0 +1,330 @@
+/**
+ * @file
+ *
+ * @brief Provides the CompressionProcessor class used to compress the payloads of the repetitive telemetry packets
+ * before they are COBS-encoded and to decompress them after they are decoded.
+ *
+ * @section cp_description Description:
+ * The payloads of the telemetry packets often store slowly varying sensor arrays, which contain long runs of repeated
+ * bytes or 16-bit samples that differ little from their predecessors. The CompressionProcessor class measures the size
+ * of each payload compressed with each supported method and compresses the payload with the method that produces the
+ * smallest result. The method is stored in the compression header byte that precedes the compressed payload, so each
+ * packet can use a different method.
+ *
+ * @section cp_methods Compression Methods:
+ * - Run-length: each control byte below 128 is followed by (control + 1) literal bytes, and each control byte at or
+ * above 128 is followed by a single byte that is repeated (control - 125) times.
+ * - Delta: the payload is interpreted as a sequence of little-endian 16-bit samples. Each sample is replaced with its
+ * difference from the preceding sample (the first sample is compared to 0), zigzag-encoded so that small negative
+ * differences become small positive values, and stored as a 1- to 3-byte little-endian base-128 varint. If the payload
+ * has an odd size, the last byte is stored without compression and the kOddSizeFlag bit of the header is set.
+ *
+ * If no method produces a payload smaller than the input payload, the payload is stored without compression. Therefore,
+ * the compressed payload is at most 1 byte (the header byte) larger than the input payload.
+ */
+
+#ifndef AXTLMC_COMPRESSION_PROCESSOR_H
+#define AXTLMC_COMPRESSION_PROCESSOR_H
+
+// Dependencies
+#include <Arduino.h>
+#include "axtlmc_shared_assets.h"
+
+using namespace axtlmc_shared_assets;
+
+/**
+ * @brief Provides methods for compressing and decompressing payloads using the run-length and the delta encoding
+ * schemes.
+ */
+class CompressionProcessor final
+{
+    public:
+        /// The header bit that marks the delta-encoded payloads whose last byte is stored without compression.
+        static constexpr uint8_t kOddSizeFlag = 0x80;
+
+        /**
+         * @brief Compresses the input payload with the method that produces the smallest result.
+         *
+         * @param source The buffer that stores the payload to compress.
+         * @param source_size The size of the payload to compress, in bytes.
+         * @param destination The buffer that receives the compression header byte and the compressed payload. Must
+         * have room for at least source_size + 1 bytes.
+         *
+         * @returns the size of the compressed payload, including the header byte, in bytes.
+         */
+        static uint16_t Compress(const uint8_t* source, const uint16_t source_size, uint8_t* destination)
+        {
+            // Measures the size of the payload compressed with each method without writing it.
+            const uint16_t run_length_size = EncodeRunLength<false>(source, source_size, nullptr);
+            const uint16_t delta_size      = EncodeDelta<false>(source, source_size, nullptr);
+
+            if (run_length_size < source_size && run_length_size <= delta_size)
+            {
+                destination[0] = static_cast<uint8_t>(kCompressionMethods::kRunLength);
+                return EncodeRunLength<true>(source, source_size, &destination[1]) + 1;
+            }
+
+            if (delta_size < source_size)
+            {
+                destination[0] = static_cast<uint8_t>(kCompressionMethods::kDelta);
+                if (source_size & 1) destination[0] |= kOddSizeFlag;
+                return EncodeDelta<true>(source, source_size, &destination[1]) + 1;
+            }
+
+            destination[0] = static_cast<uint8_t>(kCompressionMethods::kNone);
+            memcpy(&destination[1], source, source_size);
+            return source_size + 1;
+        }
+
+        /**
+         * @brief Decompresses the input payload compressed by the Compress() method.
+         *
+         * @param source The buffer that stores the compression header byte and the compressed payload.
+         * @param source_size The size of the compressed payload, including the header byte, in bytes.
+         * @param destination The buffer that receives the decompressed payload.
+         * @param capacity The size of the destination buffer, in bytes.
+         * @param size The variable that receives the size of the decompressed payload, in bytes.
+         *
+         * @returns true if the payload was decompressed, or false if the payload uses an unknown method, is
+         * malformed, or does not fit into the destination buffer.
+         */
+        static bool Decompress(
+            const uint8_t* source,
+            const uint16_t source_size,
+            uint8_t* destination,
+            const uint16_t capacity,
+            uint16_t& size
+        )
+        {
+            if (source_size == 0) return false;
+
+            const uint8_t* body      = &source[1];
+            const uint16_t body_size = source_size - 1;
+            switch (source[0])
+            {
+                case static_cast<uint8_t>(kCompressionMethods::kNone):
+                    if (body_size > capacity) return false;
+                    memcpy(destination, body, body_size);
+                    size = body_size;
+                    return true;
+
+                case static_cast<uint8_t>(kCompressionMethods::kRunLength):
+                    return DecodeRunLength(body, body_size, destination, capacity, size);
+
+                case static_cast<uint8_t>(kCompressionMethods::kDelta):
+                case static_cast<uint8_t>(kCompressionMethods::kDelta) | kOddSizeFlag:
+                    return DecodeDelta(body, body_size, (source[0] & kOddSizeFlag) != 0, destination, capacity, size);
+
+                default: return false;
+            }
+        }
+
+    private:
+        /// Stores the shortest run of repeated bytes encoded as a run.
+        static constexpr uint8_t kMinimumRun = 3;
+
+        /// Stores the longest run of repeated bytes encoded by a single control byte.
+        static constexpr uint8_t kMaximumRun = 127 + kMinimumRun;
+
+        /// Stores the largest number of literal bytes that follow a single control byte.
+        static constexpr uint8_t kMaximumLiterals = 128;
+
+        /**
+         * @brief Encodes the input payload with the run-length scheme.
+         *
+         * @tparam kWrite Determines whether to write the encoded payload to the destination buffer (true) or to only
+         * measure its size (false).
+         * @param source The buffer that stores the payload to encode.
+         * @param source_size The size of the payload to encode, in bytes.
+         * @param destination The buffer that receives the encoded payload. Not used if kWrite is false.
+         *
+         * @returns the size of the encoded payload, in bytes.
+         */
+        template <const bool kWrite>
+        static uint16_t EncodeRunLength(const uint8_t* source, const uint16_t source_size, uint8_t* destination)
+        {
+            uint16_t size          = 0;
+            uint16_t literal_start = 0;
+            uint16_t index         = 0;
+            while (index < source_size)
+            {
+                // Measures the run of repeated bytes that starts at the current index.
+                uint16_t run = 1;
+                while (index + run < source_size && run < kMaximumRun && source[index + run] == source[index]) run++;
+
+                if (run < kMinimumRun)
+                {
+                    index++;
+                    continue;
+                }
+
+                // Writes the literal bytes that precede the run, followed by the run.
+                size = EncodeLiterals<kWrite>(&source[literal_start], index - literal_start, destination, size);
+                if (kWrite)
+                {
+                    destination[size]     = static_cast<uint8_t>(run - kMinimumRun + 128);
+                    destination[size + 1] = source[index];
+                }
+                size += 2;
+                index += run;
+                literal_start = index;
+            }
+            return EncodeLiterals<kWrite>(&source[literal_start], source_size - literal_start, destination, size);
+        }
+
+        /**
+         * @brief Writes the input literal bytes as one or more literal chunks of the run-length scheme.
+         *
+         * @tparam kWrite Determines whether to write the literal chunks to the destination buffer (true) or to only
+         * measure their size (false).
+         * @param literals The buffer that stores the literal bytes.
+         * @param literal_count The number of literal bytes.
+         * @param destination The buffer that receives the literal chunks. Not used if kWrite is false.
+         * @param size The number of bytes already written to the destination buffer.
+         *
+         * @returns the number of bytes written to the destination buffer after writing the literal chunks.
+         */
+        template <const bool kWrite>
+        static uint16_t
+        EncodeLiterals(const uint8_t* literals, uint16_t literal_count, uint8_t* destination, uint16_t size)
+        {
+            while (literal_count > 0)
+            {
+                const uint8_t chunk = literal_count < kMaximumLiterals ? literal_count : kMaximumLiterals;
+                if (kWrite)
+                {
+                    destination[size] = chunk - 1;
+                    memcpy(&destination[size + 1], literals, chunk);
+                }
+                size += chunk + 1;
+                literals += chunk;
+                literal_count -= chunk;
+            }
+            return size;
+        }
+
+        /// Decodes the input run-length-encoded payload into the destination buffer. Returns false if the payload is
+        /// malformed or does not fit into the destination buffer.
+        static bool DecodeRunLength(
+            const uint8_t* source,
+            const uint16_t source_size,
+            uint8_t* destination,
+            const uint16_t capacity,
+            uint16_t& size
+        )
+        {
+            uint16_t read_index  = 0;
+            uint16_t write_index = 0;
+            while (read_index < source_size)
+            {
+                const uint8_t control = source[read_index++];
+                if (control < 128)
+                {
+                    const uint16_t count = control + 1;
+                    if (read_index + count > source_size || write_index + count > capacity) return false;
+                    memcpy(&destination[write_index], &source[read_index], count);
+                    read_index += count;
+                    write_index += count;
+                    continue;
+                }
+
+                const uint16_t count = control - 128 + kMinimumRun;
+                if (read_index == source_size || write_index + count > capacity) return false;
+                memset(&destination[write_index], source[read_index++], count);
+                write_index += count;
+            }
+            size = write_index;
+            return true;
+        }
+
+        /**
+         * @brief Encodes the input payload with the delta scheme.
+         *
+         * @tparam kWrite Determines whether to write the encoded payload to the destination buffer (true) or to only
+         * measure its size (false).
+         * @param source The buffer that stores the payload to encode.
+         * @param source_size The size of the payload to encode, in bytes.
+         * @param destination The buffer that receives the encoded payload. Not used if kWrite is false.
+         *
+         * @returns the size of the encoded payload, in bytes.
+         */
+        template <const bool kWrite>
+        static uint16_t EncodeDelta(const uint8_t* source, const uint16_t source_size, uint8_t* destination)
+        {
+            uint16_t size     = 0;
+            uint16_t previous = 0;
+            for (uint16_t index = 0; index + 1 < source_size; index += 2)
+            {
+                const auto sample = static_cast<uint16_t>(source[index] | source[index + 1] << 8);
+                const auto delta  = static_cast<uint16_t>(sample - previous);
+                previous          = sample;
+
+                // Zigzag-encodes the difference, so that the small negative differences use the small values.
+                auto value = static_cast<uint16_t>(delta << 1 ^ (delta & 0x8000 ? 0xFFFF : 0));
+                while (value >= 0x80)
+                {
+                    if (kWrite) destination[size] = static_cast<uint8_t>(value | 0x80);
+                    size++;
+                    value >>= 7;
+                }
+                if (kWrite) destination[size] = static_cast<uint8_t>(value);
+                size++;
+            }
+
+            // Stores the last byte of the odd-sized payloads without compression.
+            if (source_size & 1)
+            {
+                if (kWrite) destination[size] = source[source_size - 1];
+                size++;
+            }
+            return size;
+        }
+
+        /// Decodes the input delta-encoded payload into the destination buffer. Returns false if the payload is
+        /// malformed or does not fit into the destination buffer.
+        static bool DecodeDelta(
+            const uint8_t* source,
+            const uint16_t source_size,
+            const bool odd_size,
+            uint8_t* destination,
+            const uint16_t capacity,
+            uint16_t& size
+        )
+        {
+            if (odd_size && source_size == 0) return false;
+            const uint16_t samples_end = odd_size ? source_size - 1 : source_size;
+
+            uint16_t read_index  = 0;
+            uint16_t write_index = 0;
+            uint16_t previous    = 0;
+            while (read_index < samples_end)
+            {
+                // Reads the varint, which must not exceed 3 bytes or the 16-bit value range.
+                uint32_t value = 0;
+                for (uint8_t shift = 0;; shift += 7)
+                {
+                    if (read_index == samples_end || shift > 14) return false;
+                    const uint8_t byte_value = source[read_index++];
+                    value |= static_cast<uint32_t>(byte_value & 0x7F) << shift;
+                    if ((byte_value & 0x80) == 0) break;
+                }
+                if (value > 0xFFFF || write_index + 2 > capacity) return false;
+
+                const auto delta = static_cast<uint16_t>(value >> 1 ^ (value & 1 ? 0xFFFF : 0));
+                previous += delta;
+                destination[write_index]     = static_cast<uint8_t>(previous);
+                destination[write_index + 1] = static_cast<uint8_t>(previous >> 8);
+                write_index += 2;
+            }
+
+            if (odd_size)
+            {
+                if (write_index + 1 > capacity) return false;
+                destination[write_index++] = source[samples_end];
+            }
+            size = write_index;
+            return true;
+        }
+};
+
+#endif  //AXTLMC_COMPRESSION_PROCESSOR_H
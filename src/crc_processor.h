@@ -19,6 +19,528 @@
 
 using namespace axtlmc_shared_assets;
 
+// Precomputed lookup tables stored in flash must be read through the pgm_read_* functions on AVR boards, which use
+// separate address spaces for program and data memory. On all other supported boards, const data is placed in flash
+// by the linker and is addressed directly.
+#if defined(__AVR__)
+#define AXTLMC_FLASH_STORAGE PROGMEM
+#else
+#define AXTLMC_FLASH_STORAGE
+#endif
+
+/**
+ * @brief Stores the 256-entry CRC lookup table in RAM and uses it to update CRC checksums one byte at a time.
+ *
+ * This is the default CRC kernel used by the CRCProcessor class. It generates the lookup table at initialization for
+ * the polynomial provided at runtime, which reserves 256, 512, or 1024 bytes of RAM depending on the type of the
+ * polynomial.
+ *
+ * @tparam PolynomialType The datatype of the CRC polynomial used by the kernel instance. Valid types are uint8_t,
+ * uint16_t, and uint32_t.
+ * @tparam kReflected Determines whether the kernel processes the data bits LSB-first (reflected, as in CRC-32/zlib
+ * and CRC-16/MODBUS) or MSB-first (non-reflected). Reflected kernels store the checksum in bit-reversed order and
+ * update it by shifting right, which avoids aligning each data byte to the high byte of the checksum.
+ */
+template <typename PolynomialType, const bool kReflected = false>
+class CRCTableKernel final
+{
+    public:
+        /// The datatype of the CRC checksums computed by the kernel.
+        using ChecksumType = PolynomialType;
+
+        /// Determines whether the kernel computes reflected (LSB-first) CRC checksums.
+        static constexpr bool kIsReflected = kReflected;
+
+        /**
+         * @brief Generates the lookup table used by the instance to speed up future CRC checksum calculations.
+         *
+         * @param polynomial The polynomial to use for the generation of the CRC lookup table. The polynomial must
+         * be standard (non-reflected / non-reversed), even for reflected kernels.
+         */
+        explicit CRCTableKernel(const PolynomialType polynomial) : _polynomial(polynomial)
+        {
+            for (uint16_t byte = 0; byte < 256; ++byte)
+            {
+                _crc_table[byte] = CalculateTableEntry(polynomial, static_cast<uint8_t>(byte));
+            }
+        }
+
+        /**
+         * @brief Updates the running CRC checksum with the input data bytes.
+         *
+         * @param checksum The running CRC checksum to update.
+         * @param data The pointer to the data bytes to add to the checksum.
+         * @param size The number of data bytes to add to the checksum.
+         *
+         * @returns the updated running CRC checksum.
+         */
+        PolynomialType Update(PolynomialType checksum, const uint8_t* data, const uint16_t size) const
+        {
+            for (uint16_t i = 0; i < size; i++)
+            {
+                if constexpr (kReflected)
+                {
+                    // For reflected checksums, the low byte of the checksum is combined with the data byte and the
+                    // checksum is shifted right.
+                    checksum = static_cast<PolynomialType>(checksum >> 8) ^ _crc_table[(checksum ^ data[i]) & 0xFF];
+                }
+                else
+                {
+                    // Combines the high byte of the CRC checksum with the data byte using bitwise XOR to calculate the
+                    // lookup table index.
+                    const uint8_t table_index = checksum >> 8 * (kCRCByteLength - 1) ^ data[i];
+
+                    // Retrieves the byte-specific CRC value from the table and XORs it with the shifted checksum to
+                    // produce an updated checksum.
+                    checksum = checksum << 8 ^ _crc_table[table_index];
+                }
+            }
+            return checksum;
+        }
+
+        /// Returns the standard (non-reflected) polynomial used by the instance.
+        [[nodiscard]]
+        PolynomialType get_polynomial() const
+        {
+            return _polynomial;
+        }
+
+        /// Returns a const pointer to the CRC lookup table used by the instance.
+        [[nodiscard]]
+        const PolynomialType* get_table() const
+        {
+            return _crc_table;
+        }
+
+        /**
+         * @brief Reverses the order of the bits in the input value.
+         *
+         * @param value The value to reflect.
+         *
+         * @returns the reflected value.
+         */
+        static constexpr PolynomialType Reflect(PolynomialType value)
+        {
+            PolynomialType reflected = 0;
+            for (uint8_t bit = 0; bit < kCRCByteLength * 8; ++bit, value >>= 1)
+            {
+                reflected = static_cast<PolynomialType>(reflected << 1 | (value & 1));
+            }
+            return reflected;
+        }
+
+        /**
+         * @brief Computes the CRC lookup table entry for the given polynomial and byte value.
+         *
+         * This method is evaluated at compile time to generate the lookup tables stored in flash and at runtime to
+         * generate the lookup tables stored in RAM.
+         *
+         * @param polynomial The standard (non-reflected) CRC polynomial to use for the calculation.
+         * @param byte The byte value for which to compute the table entry.
+         *
+         * @returns the CRC remainder of the byte value aligned to the highest byte of the CRC variable for
+         * non-reflected kernels, or the reflected remainder of the byte value for reflected kernels.
+         */
+        static constexpr PolynomialType CalculateTableEntry(const PolynomialType polynomial, const uint8_t byte)
+        {
+            // Determines the number of bits in the CRC type.
+            constexpr size_t kCRCBits = kCRCByteLength * 8;
+
+            // Determines the Most Significant Bit (MSB) mask based on the CRC type.
+            constexpr PolynomialType kMSBMask = static_cast<PolynomialType>(1) << (kCRCBits - 1);
+
+            // Initializes the byte CRC value based on the CRC (Polynomial) datatype.
+            auto crc = static_cast<PolynomialType>(byte);
+
+            // Reflected tables process the byte starting with the Least Significant Bit (LSB), using the reversed
+            // polynomial and shifting the CRC value right.
+            if constexpr (kReflected)
+            {
+                const PolynomialType reversed_polynomial = Reflect(polynomial);
+                for (uint8_t bit = 0; bit < 8; ++bit)
+                {
+                    crc = crc & 1 ? static_cast<PolynomialType>(crc >> 1 ^ reversed_polynomial)
+                                  : static_cast<PolynomialType>(crc >> 1);
+                }
+                return crc;
+            }
+
+            // Shifts the CRC value left by the appropriate number of bits based on the CRC type to align the
+            // initial value to the highest byte of the CRC variable.
+            if (kCRCBits > 8)
+            {
+                crc <<= kCRCBits - 8;
+            }
+
+            // Loops over each of the 8 bits making up the byte value being processed.
+            for (uint8_t bit = 0; bit < 8; ++bit)
+            {
+                // Checks if the top bit (MSB) is set.
+                if (crc & kMSBMask)
+                {
+                    // Shifts the CRC value left to bring the next bit into the top position, then XORs it with
+                    // the polynomial. This simulates polynomial division where bits are checked from top to bottom.
+                    crc = static_cast<PolynomialType>(crc << 1 ^ polynomial);
+                }
+                else
+                {
+                    // Shifts the CRC value left to move to the next bit without modifying the current value, as
+                    // division by the polynomial would not produce a remainder here.
+                    crc <<= 1;
+                }
+            }
+
+            return crc;
+        }
+
+    private:
+        /// Stores the size of the CRC polynomial in bytes.
+        static constexpr uint8_t kCRCByteLength = sizeof(PolynomialType);  // NOLINT(*-dynamic-static-initializers)
+
+        /// Stores the polynomial used to generate the lookup table.
+        const PolynomialType _polynomial;
+
+        /// Stores the lookup table used to speed up CRC computation at runtime.
+        PolynomialType _crc_table[256];
+};
+
+/**
+ * @brief Stores the 256-entry CRC lookup table for a compile-time polynomial.
+ *
+ * The table is computed by the compiler, so it can be placed in flash together with the rest of the read-only data.
+ *
+ * @tparam PolynomialType The datatype of the CRC polynomial.
+ * @tparam kPolynomial The polynomial to use for the generation of the CRC lookup table.
+ * @tparam kReflected Determines whether to generate the table for reflected (LSB-first) CRC checksums.
+ */
+template <typename PolynomialType, const PolynomialType kPolynomial, const bool kReflected>
+struct CRCFlashTable
+{
+        /// The table entries, indexed by the byte value.
+        PolynomialType values[256];
+
+        /// Computes all table entries at compile time.
+        constexpr CRCFlashTable() : values()
+        {
+            for (uint16_t byte = 0; byte < 256; ++byte)
+            {
+                values[byte] = CRCTableKernel<PolynomialType, kReflected>::CalculateTableEntry(kPolynomial, byte);
+            }
+        }
+};
+
+/**
+ * @brief Stores the 256-entry CRC lookup table in flash and uses it to update CRC checksums one byte at a time.
+ *
+ * This kernel trades lookup speed for RAM: it does not reserve any RAM for the lookup table, but each table lookup
+ * has to read program memory, which is slower than reading RAM on some boards. On AVR boards, the table is stored in
+ * PROGMEM and read via the pgm_read_* functions. On all other boards, the table is stored as regular const data.
+ *
+ * @note Since the table is generated at compile time, the polynomial has to be specified as a template parameter. The
+ * template polynomial is also used as the CRCProcessor's and the TransportLayer's default polynomial. If a different
+ * polynomial is passed to the CRCProcessor class, the processor reports the mismatch via its has_polynomial_mismatch()
+ * method.
+ *
+ * @tparam PolynomialType The datatype of the CRC polynomial used by the kernel instance. Valid types are uint8_t,
+ * uint16_t, and uint32_t.
+ * @tparam kPolynomial The polynomial to use for the generation of the CRC lookup table. The polynomial must be
+ * standard (non-reflected / non-reversed).
+ * @tparam kReflected Determines whether the kernel computes reflected (LSB-first) CRC checksums.
+ */
+template <typename PolynomialType, const PolynomialType kPolynomial, const bool kReflected = false>
+class CRCFlashTableKernel final
+{
+    public:
+        /// The datatype of the CRC checksums computed by the kernel.
+        using ChecksumType = PolynomialType;
+
+        /// Determines whether the kernel computes reflected (LSB-first) CRC checksums.
+        static constexpr bool kIsReflected = kReflected;
+
+        /// The polynomial used to generate the lookup table, which is also used when the caller does not specify the
+        /// polynomial.
+        static constexpr PolynomialType kDefaultPolynomial = kPolynomial;
+
+        /// Initializes the kernel. The lookup table is generated at compile time, so the kernel always uses the
+        /// kPolynomial. The CRCProcessor class verifies that the requested polynomial matches it.
+        explicit CRCFlashTableKernel(const PolynomialType polynomial = kPolynomial)
+        {
+            static_cast<void>(polynomial);
+        }
+
+        /**
+         * @brief Updates the running CRC checksum with the input data bytes.
+         *
+         * @param checksum The running CRC checksum to update.
+         * @param data The pointer to the data bytes to add to the checksum.
+         * @param size The number of data bytes to add to the checksum.
+         *
+         * @returns the updated running CRC checksum.
+         */
+        PolynomialType Update(PolynomialType checksum, const uint8_t* data, const uint16_t size) const
+        {
+            for (uint16_t i = 0; i < size; i++)
+            {
+                if constexpr (kReflected)
+                {
+                    checksum = static_cast<PolynomialType>(checksum >> 8) ^ ReadTableEntry((checksum ^ data[i]) & 0xFF);
+                }
+                else
+                {
+                    const uint8_t table_index = checksum >> 8 * (kCRCByteLength - 1) ^ data[i];
+                    checksum                  = checksum << 8 ^ ReadTableEntry(table_index);
+                }
+            }
+            return checksum;
+        }
+
+        /// Returns the standard (non-reflected) polynomial used by the instance.
+        [[nodiscard]]
+        static constexpr PolynomialType get_polynomial()
+        {
+            return kPolynomial;
+        }
+
+        /// Returns a const pointer to the CRC lookup table used by the instance. On AVR boards, the returned pointer
+        /// addresses program memory and has to be read via the pgm_read_* functions.
+        [[nodiscard]]
+        static const PolynomialType* get_table()
+        {
+            return kTable.values;
+        }
+
+    private:
+        /// Stores the size of the CRC polynomial in bytes.
+        static constexpr uint8_t kCRCByteLength = sizeof(PolynomialType);  // NOLINT(*-dynamic-static-initializers)
+
+        /// Stores the lookup table used to speed up CRC computation at runtime.
+        static constexpr CRCFlashTable<PolynomialType, kPolynomial, kReflected> kTable AXTLMC_FLASH_STORAGE {};
+
+        /// Reads the requested entry from the lookup table.
+        static PolynomialType ReadTableEntry(const uint8_t index)
+        {
+#if defined(__AVR__)
+            if constexpr (kCRCByteLength == 1) return pgm_read_byte(&kTable.values[index]);
+            else if constexpr (kCRCByteLength == 2) return pgm_read_word(&kTable.values[index]);
+            else return pgm_read_dword(&kTable.values[index]);
+#else
+            return kTable.values[index];
+#endif
+        }
+};
+
+/**
+ * @brief Stores a 16-entry CRC lookup table in RAM and uses it to update CRC checksums one nibble (4 bits) at a time.
+ *
+ * This kernel reserves 16, 32, or 64 bytes of RAM for the lookup table depending on the type of the polynomial, at the
+ * cost of performing two table lookups per processed byte.
+ *
+ * @tparam PolynomialType The datatype of the CRC polynomial used by the kernel instance. Valid types are uint8_t,
+ * uint16_t, and uint32_t.
+ * @tparam kReflected Determines whether the kernel computes reflected (LSB-first) CRC checksums.
+ */
+template <typename PolynomialType, const bool kReflected = false>
+class CRCNibbleTableKernel final
+{
+    public:
+        /// The datatype of the CRC checksums computed by the kernel.
+        using ChecksumType = PolynomialType;
+
+        /// Determines whether the kernel computes reflected (LSB-first) CRC checksums.
+        static constexpr bool kIsReflected = kReflected;
+
+        /**
+         * @brief Generates the lookup table used by the instance to speed up future CRC checksum calculations.
+         *
+         * @param polynomial The polynomial to use for the generation of the CRC lookup table. The polynomial must
+         * be standard (non-reflected / non-reversed), even for reflected kernels.
+         */
+        explicit CRCNibbleTableKernel(const PolynomialType polynomial) : _polynomial(polynomial)
+        {
+            // Each entry is the CRC remainder of the nibble value aligned to the highest nibble of the CRC variable
+            // (or to the lowest nibble for reflected kernels), after processing the 4 bits that contain the nibble.
+            const PolynomialType reversed_polynomial = CRCTableKernel<PolynomialType>::Reflect(polynomial);
+            for (uint8_t nibble = 0; nibble < 16; ++nibble)
+            {
+                if constexpr (kReflected)
+                {
+                    auto crc = static_cast<PolynomialType>(nibble);
+                    for (uint8_t bit = 0; bit < 4; ++bit)
+                    {
+                        crc = crc & 1 ? static_cast<PolynomialType>(crc >> 1 ^ reversed_polynomial)
+                                      : static_cast<PolynomialType>(crc >> 1);
+                    }
+                    _crc_table[nibble] = crc;
+                }
+                else
+                {
+                    auto crc = static_cast<PolynomialType>(static_cast<PolynomialType>(nibble) << (kCRCBits - 4));
+                    for (uint8_t bit = 0; bit < 4; ++bit)
+                    {
+                        crc = crc & kMSBMask ? static_cast<PolynomialType>(crc << 1 ^ polynomial)
+                                             : static_cast<PolynomialType>(crc << 1);
+                    }
+                    _crc_table[nibble] = crc;
+                }
+            }
+        }
+
+        /**
+         * @brief Updates the running CRC checksum with the input data bytes.
+         *
+         * @param checksum The running CRC checksum to update.
+         * @param data The pointer to the data bytes to add to the checksum.
+         * @param size The number of data bytes to add to the checksum.
+         *
+         * @returns the updated running CRC checksum.
+         */
+        PolynomialType Update(PolynomialType checksum, const uint8_t* data, const uint16_t size) const
+        {
+            for (uint16_t i = 0; i < size; i++)
+            {
+                if constexpr (kReflected)
+                {
+                    // Combines the data byte with the low byte of the checksum and processes the low and the high
+                    // nibbles of the result in that order.
+                    checksum ^= data[i];
+                    checksum = static_cast<PolynomialType>(checksum >> 4) ^ _crc_table[checksum & 0x0F];
+                    checksum = static_cast<PolynomialType>(checksum >> 4) ^ _crc_table[checksum & 0x0F];
+                }
+                else
+                {
+                    // Combines the data byte with the high byte of the checksum and processes the high and the low
+                    // nibbles of the result in that order.
+                    checksum ^= static_cast<PolynomialType>(static_cast<PolynomialType>(data[i]) << (kCRCBits - 8));
+                    checksum = static_cast<PolynomialType>(checksum << 4) ^ _crc_table[checksum >> (kCRCBits - 4)];
+                    checksum = static_cast<PolynomialType>(checksum << 4) ^ _crc_table[checksum >> (kCRCBits - 4)];
+                }
+            }
+            return checksum;
+        }
+
+        /// Returns the standard (non-reflected) polynomial used by the instance.
+        [[nodiscard]]
+        PolynomialType get_polynomial() const
+        {
+            return _polynomial;
+        }
+
+        /// Returns a const pointer to the 16-entry CRC lookup table used by the instance.
+        [[nodiscard]]
+        const PolynomialType* get_table() const
+        {
+            return _crc_table;
+        }
+
+    private:
+        /// Stores the number of bits in the CRC type.
+        static constexpr uint8_t kCRCBits = sizeof(PolynomialType) * 8;  // NOLINT(*-dynamic-static-initializers)
+
+        /// Stores the Most Significant Bit (MSB) mask for the CRC type.
+        static constexpr PolynomialType kMSBMask =             // NOLINT(*-dynamic-static-initializers)
+            static_cast<PolynomialType>(1) << (kCRCBits - 1);  // Parentheses required to avoid compiler warnings
+
+        /// Stores the polynomial used to generate the lookup table.
+        const PolynomialType _polynomial;
+
+        /// Stores the lookup table used to speed up CRC computation at runtime.
+        PolynomialType _crc_table[16];
+};
+
+/**
+ * @brief Updates CRC checksums one bit at a time without using a lookup table.
+ *
+ * This kernel does not reserve any memory beyond the polynomial, but it is the slowest of the available kernels, as
+ * it performs 8 shift-and-XOR steps for each processed byte.
+ *
+ * @tparam PolynomialType The datatype of the CRC polynomial used by the kernel instance. Valid types are uint8_t,
+ * uint16_t, and uint32_t.
+ * @tparam kReflected Determines whether the kernel computes reflected (LSB-first) CRC checksums.
+ */
+template <typename PolynomialType, const bool kReflected = false>
+class CRCBitwiseKernel final
+{
+    public:
+        /// The datatype of the CRC checksums computed by the kernel.
+        using ChecksumType = PolynomialType;
+
+        /// Determines whether the kernel computes reflected (LSB-first) CRC checksums.
+        static constexpr bool kIsReflected = kReflected;
+
+        /**
+         * @brief Initializes the kernel.
+         *
+         * @param polynomial The polynomial to use for the CRC checksum calculation. The polynomial must be standard
+         * (non-reflected / non-reversed), even for reflected kernels.
+         */
+        explicit CRCBitwiseKernel(const PolynomialType polynomial) :
+            _polynomial(polynomial), _reversed_polynomial(CRCTableKernel<PolynomialType>::Reflect(polynomial))
+        {}
+
+        /**
+         * @brief Updates the running CRC checksum with the input data bytes.
+         *
+         * @param checksum The running CRC checksum to update.
+         * @param data The pointer to the data bytes to add to the checksum.
+         * @param size The number of data bytes to add to the checksum.
+         *
+         * @returns the updated running CRC checksum.
+         */
+        PolynomialType Update(PolynomialType checksum, const uint8_t* data, const uint16_t size) const
+        {
+            for (uint16_t i = 0; i < size; i++)
+            {
+                if constexpr (kReflected)
+                {
+                    checksum ^= data[i];
+                    for (uint8_t bit = 0; bit < 8; ++bit)
+                    {
+                        checksum = checksum & 1 ? static_cast<PolynomialType>(checksum >> 1 ^ _reversed_polynomial)
+                                                : static_cast<PolynomialType>(checksum >> 1);
+                    }
+                }
+                else
+                {
+                    checksum ^= static_cast<PolynomialType>(static_cast<PolynomialType>(data[i]) << (kCRCBits - 8));
+                    for (uint8_t bit = 0; bit < 8; ++bit)
+                    {
+                        checksum = checksum & kMSBMask ? static_cast<PolynomialType>(checksum << 1 ^ _polynomial)
+                                                       : static_cast<PolynomialType>(checksum << 1);
+                    }
+                }
+            }
+            return checksum;
+        }
+
+        /// Returns the standard (non-reflected) polynomial used by the instance.
+        [[nodiscard]]
+        PolynomialType get_polynomial() const
+        {
+            return _polynomial;
+        }
+
+        /// Returns nullptr, as the kernel does not use a lookup table.
+        [[nodiscard]]
+        static const PolynomialType* get_table()
+        {
+            return nullptr;
+        }
+
+    private:
+        /// Stores the number of bits in the CRC type.
+        static constexpr uint8_t kCRCBits = sizeof(PolynomialType) * 8;  // NOLINT(*-dynamic-static-initializers)
+
+        /// Stores the Most Significant Bit (MSB) mask for the CRC type.
+        static constexpr PolynomialType kMSBMask =             // NOLINT(*-dynamic-static-initializers)
+            static_cast<PolynomialType>(1) << (kCRCBits - 1);  // Parentheses required to avoid compiler warnings
+
+        /// Stores the polynomial used for the CRC checksum calculation.
+        const PolynomialType _polynomial;
+
+        /// Stores the bit-reversed polynomial used by reflected kernels.
+        const PolynomialType _reversed_polynomial;
+};
+
 /**
  * @brief Provides methods for calculating Cyclic Redundancy Check (CRC) checksums and using them to verify the
  * integrity of the incoming and outgoing data packets.
@@ -27,13 +549,33 @@ using namespace axtlmc_shared_assets;
  * end-users. It makes specific assumptions about the layout and contents of the processed data buffers that are
  * not verified during runtime and must be enforced through the use of the TransportLayer class.
  *
- * @note Each class instance computes a CRC lookup table at initialization. The table reserves 256, 512, or 1024 bytes
- * of memory depending on the type of the CRC polynomial for the entire lifetime of the instance.
+ * @note By default, each class instance computes a CRC lookup table at initialization. The table reserves 256, 512,
+ * or 1024 bytes of memory depending on the type of the CRC polynomial for the entire lifetime of the instance. Use
+ * the CRCFlashTableKernel as the KernelType to store the table in flash instead, or the CRCNibbleTableKernel and
+ * CRCBitwiseKernel to trade calculation speed for a smaller or no lookup table. Additionally, each instance stores 9
+ * precomputed polynomial powers used to incrementally patch checksums.
+ *
+ * This class is the default checksum engine used by the TransportLayer class. Any class that implements the same
+ * engine interface can be used by the TransportLayer class instead:
+ * - A public ChecksumType alias that specifies the unsigned integer type used to store the checksum.
+ * - A public static constexpr uint8_t kChecksumSize member that specifies the size of the checksum postamble, in
+ * bytes. The checksum is transmitted starting with its most significant byte.
+ * - A constructor that accepts the polynomial, the initial value, and the final XOR value arguments of the
+ * TransportLayer's constructor (engines that do not need these values may ignore them).
+ * - The get_initial_value(), UpdateChecksum(), FinalizeChecksum(), and VerifyChecksum() const methods with the same
+ * signatures as the methods of this class.
+ * - Optionally, the kDefaultPolynomial static constexpr member, which replaces 0x07 as the TransportLayer's default
+ * polynomial, and the has_polynomial_mismatch() const method, which reports whether the engine cannot use the
+ * polynomial passed to its constructor. The TransportLayer class reports the mismatch via its own
+ * has_polynomial_mismatch() method.
  *
  * @tparam PolynomialType The datatype of the CRC polynomial used by the class instance. Valid types are uint8_t,
  * uint16_t, and uint32_t.
+ * @tparam KernelType The kernel used to update the CRC checksums with the processed data bytes. Determines where the
+ * CRC lookup table is stored and whether the checksums are reflected (LSB-first). Defaults to the non-reflected
+ * CRCTableKernel, which stores the table in RAM.
  */
-template <typename PolynomialType>
+template <typename PolynomialType, typename KernelType = CRCTableKernel<PolynomialType>>
 class CRCProcessor final
 {
         // Prevents passing unsupported data types as the PolynomialType parameter.
@@ -43,15 +585,35 @@ class CRCProcessor final
             "CRCProcessor class template PolynomialType argument must be either uint8_t, uint16_t, or uint32_t."
         );
 
+        // Ensures that the kernel computes checksums of the same type as the processor.
+        static_assert(
+            is_same_v<typename KernelType::ChecksumType, PolynomialType>,
+            "CRCProcessor class template KernelType argument must compute checksums of the PolynomialType."
+        );
+
     public:
+        /// The datatype of the CRC checksums computed by the processor.
+        using ChecksumType = PolynomialType;
+
+        /// The size of the CRC checksum postamble, in bytes.
+        static constexpr uint8_t kChecksumSize = sizeof(PolynomialType);  // NOLINT(*-dynamic-static-initializers)
+
+        /// The polynomial used when the caller does not specify the polynomial. Matches the compile-time polynomial of
+        /// the kernels that generate their lookup table at compile time and is 0x07 for all other kernels.
+        static constexpr PolynomialType kDefaultPolynomial =  // NOLINT(*-dynamic-static-initializers)
+            default_polynomial<KernelType, PolynomialType>::value;
+
         /**
          * @brief Generates the lookup table used by the instance to speed up future CRC checksum calculations.
          *
-         * @note The implementation is MSB-first (left-shifting). The polynomial, initial value, and final XOR value
-         * must all be expressed in standard non-reflected, MSB-aligned form.
+         * @note The polynomial, initial value, and final XOR value must all be expressed in standard non-reflected,
+         * MSB-aligned form, as listed in the CRC catalogues. For reflected (LSB-first) kernels, the instance reflects
+         * the initial value before using it and applies the final XOR value to the reflected checksum, which matches
+         * the reference reflected CRC implementations, such as CRC-32 used by zlib.
          *
          * @param polynomial The polynomial to use for the generation of the CRC lookup table. The polynomial must
-         * be standard (non-reflected / non-reversed).
+         * be standard (non-reflected / non-reversed). Kernels that generate the table at compile time only accept
+         * their template polynomial and report any other value via the has_polynomial_mismatch() method.
          * @param initial_value The value to which the CRC checksum is initialized before calculation.
          * @param final_xor_value The value with which the CRC checksum is XORed after calculation.
          */
@@ -60,9 +622,12 @@ class CRCProcessor final
             const PolynomialType initial_value,
             const PolynomialType final_xor_value
         ) :
-            _initial_value(initial_value), _final_xor_value(final_xor_value)
+            _kernel(polynomial),
+            _initial_value(kReflected ? CRCTableKernel<PolynomialType>::Reflect(initial_value) : initial_value),
+            _final_xor_value(final_xor_value),
+            _polynomial_mismatch(_kernel.get_polynomial() != polynomial)
         {
-            GenerateCRCTable(polynomial);
+            GenerateShiftTable();
         }
 
         /**
@@ -73,56 +638,42 @@ class CRCProcessor final
          *
          * @tparam kCheck Determines whether the method is called to verify the incoming packet's data integrity or to
          * generate and write the CRC checksum to the outgoing packet's postamble section.
+         * @tparam LayoutType The PacketLayout of the input buffer. Defaults to the library's default layout.
          * @tparam kBufferSize The size of the input buffer.
          * @param buffer The buffer that stores the COBS-encoded packet for which to calculate the checksum. The buffer
-         * must conform to kBufferLayout, with a valid payload-size byte read to determine the processing range.
+         * must conform to the LayoutType, with a valid payload-size byte read to determine the processing range.
          *
          * @returns the total number of bytes occupied in the buffer, including the appended CRC checksum, when
          * generating a new checksum. Returns '1' when verifying data integrity and the data is intact, and '0'
          * otherwise.
          */
-        template <const bool kCheck, const size_t kBufferSize>
+        template <const bool kCheck, typename LayoutType = kBufferLayout, const size_t kBufferSize>
         uint16_t CalculateChecksum(uint8_t (&buffer)[kBufferSize])
         {
             // Initializes the checksum to the initial value of the polynomial used to generate the CRC table.
-            PolynomialType crc_checksum = _initial_value;
+            PolynomialType crc_checksum = get_initial_value();
 
             // Sets the start index to the position of the overhead byte. This specializes the function to work
             // exclusively with the buffers defined in this library, similar to how COBSProcessor's methods are
             // implemented.
-            constexpr uint16_t start_index = kBufferLayout::kOverheadByteIndex;
-
-            // Adjusts the end index to include the CRC checksum postamble when verifying data integrity, or to
-            // include just the packet itself when generating a new checksum.
-            constexpr uint16_t adjustment = kCheck ? kCRCByteLength : 0;
-
-            // Calculates the end index from the start index, the payload size byte, the fixed overhead and delimiter
-            // bytes, and the CRC postamble length when verifying.
-            const uint16_t end_index = start_index + buffer[kBufferLayout::kPayloadSizeIndex] + 2 + adjustment;
+            constexpr uint16_t start_index = LayoutType::kOverheadByteIndex;
 
-            // Iteratively calculates the CRC checksum for each byte inside the packet.
-            for (uint16_t i = start_index; i < end_index; i++)
-            {
-                // Extracts the data byte being processed into a separate variable.
-                const uint8_t data_byte = buffer[i];
-
-                // Combines the high byte of the CRC checksum with the data byte using bitwise XOR to calculate the
-                // lookup table index.
-                const uint8_t table_index = crc_checksum >> 8 * (kCRCByteLength - 1) ^ data_byte;
+            // Calculates the end index from the start index, the payload size byte, and the fixed overhead and
+            // delimiter bytes. The CRC postamble is never included in the calculation. Instead, when verifying data
+            // integrity, the calculated checksum is compared to the postamble. Unlike the alternative approach of
+            // running the postamble through the calculation and checking for a zero residue, this works for any final
+            // XOR value.
+            const uint16_t end_index = start_index + buffer[LayoutType::kPayloadSizeIndex] + 2;
 
-                // Retrieves the byte-specific CRC value from the table and XORs it with the shifted checksum to
-                // produce an updated checksum.
-                crc_checksum = crc_checksum << 8 ^ _crc_table[table_index];
-            }
-
-            // Applies the final XOR operation to the checksum. The exact algorithmic purpose depends on the specific
-            // polynomial used.
-            crc_checksum ^= _final_xor_value;
+            // Calculates the CRC checksum for the bytes inside the packet.
+            crc_checksum = UpdateChecksum(crc_checksum, &buffer[start_index], end_index - start_index);
 
             // Appends the computed checksum to the buffer immediately after the processed packet when generating a new
             // checksum. The checksum always overwrites any already existing data at the target position.
             if (!kCheck)
             {
+                crc_checksum = FinalizeChecksum(crc_checksum);
+
                 // Iteratively appends each byte of the CRC checksum to the buffer, starting with the most significant
                 // byte.
                 for (uint16_t i = 0; i < kCRCByteLength; ++i)
@@ -135,80 +686,200 @@ class CRCProcessor final
                 return end_index + kCRCByteLength;
             }
 
-            // Returns 1 if the CRC calculation on the packet and its checksum postamble yields 0, indicating the data
-            // is intact. Returns 0 otherwise, indicating data corruption.
-            if (crc_checksum == 0) return 1;
+            // Returns 1 if the calculated checksum matches the checksum stored in the packet's postamble, indicating
+            // the data is intact. Returns 0 otherwise, indicating data corruption.
+            PolynomialType received_checksum = 0;
+            for (uint16_t i = 0; i < kCRCByteLength; ++i)
+            {
+                received_checksum = received_checksum << 8 | buffer[end_index + i];
+            }
+            if (VerifyChecksum(crc_checksum, received_checksum)) return 1;
 
             return 0;
         }
 
-        /// Returns a const pointer to the CRC lookup table used by the instance.
+        /**
+         * @brief Updates the running CRC checksum with the input data bytes.
+         *
+         * This method is used to calculate the checksum of data that is not stored in a single library buffer, such
+         * as packets that are assembled from multiple memory regions during transmission. To calculate the checksum,
+         * initialize it to the value returned by get_initial_value(), feed all data bytes through this method in
+         * order, and XOR the result with the value returned by get_final_xor_value().
+         *
+         * @param checksum The running CRC checksum to update.
+         * @param data The pointer to the data bytes to add to the checksum.
+         * @param size The number of data bytes to add to the checksum.
+         *
+         * @returns the updated running CRC checksum.
+         */
+        PolynomialType UpdateChecksum(const PolynomialType checksum, const uint8_t* data, const uint16_t size) const
+        {
+            return _kernel.Update(checksum, data, size);
+        }
+
+        /**
+         * @brief Finalizes the running CRC checksum by applying the final XOR value to it.
+         *
+         * @param checksum The running CRC checksum calculated over all data bytes.
+         *
+         * @returns the final CRC checksum to be transmitted with the data.
+         */
+        [[nodiscard]]
+        PolynomialType FinalizeChecksum(const PolynomialType checksum) const
+        {
+            // The exact algorithmic purpose of the final XOR operation depends on the specific polynomial used.
+            return checksum ^ _final_xor_value;
+        }
+
+        /**
+         * @brief Determines whether the running CRC checksum calculated over the received data matches the checksum
+         * received with the data.
+         *
+         * @param checksum The running (not finalized) CRC checksum calculated over all received data bytes.
+         * @param received_checksum The checksum received with the data.
+         *
+         * @returns true if the checksums match, indicating that the data is intact, and false otherwise.
+         */
+        [[nodiscard]]
+        bool VerifyChecksum(const PolynomialType checksum, const PolynomialType received_checksum) const
+        {
+            return FinalizeChecksum(checksum) == received_checksum;
+        }
+
+        /**
+         * @brief Advances the running CRC checksum as if the requested number of zero bytes were added to it.
+         *
+         * This method runs in O(log n) time, where n is the number of zero bytes, by multiplying the checksum by the
+         * precomputed powers of x^8 modulo the CRC polynomial.
+         *
+         * @note Together with UpdateChecksum(), this method allows patching the checksum of modified data without
+         * processing the unmodified bytes. Since the CRC is linear, the checksum of the modified data is the original
+         * checksum XORed with the checksum of the difference between the original and the modified data, calculated
+         * with a zero initial value and no final XOR. For a patch of k bytes followed by n unmodified bytes, that
+         * difference checksum is obtained by running the XOR of the original and the modified bytes (or, equivalently,
+         * the original and the modified bytes separately) through UpdateChecksum() starting from 0, and then shifting
+         * the result by n zero bytes with this method.
+         *
+         * @param checksum The running CRC checksum to advance.
+         * @param zero_bytes The number of zero bytes to add to the checksum. Must not exceed 511.
+         *
+         * @returns the advanced running CRC checksum.
+         */
+        PolynomialType ShiftChecksum(PolynomialType checksum, uint16_t zero_bytes) const
+        {
+            // Reflected kernels store the checksum polynomial in bit-reversed order, so it has to be reflected before
+            // and after the multiplication.
+            if constexpr (kReflected) checksum = CRCTableKernel<PolynomialType>::Reflect(checksum);
+            for (uint8_t i = 0; zero_bytes != 0 && i < kShiftTableSize; ++i, zero_bytes >>= 1)
+            {
+                if (zero_bytes & 1) checksum = MultiplyModulo(checksum, _shift_table[i]);
+            }
+            if constexpr (kReflected) checksum = CRCTableKernel<PolynomialType>::Reflect(checksum);
+            return checksum;
+        }
+
+        /// Returns the value to which the CRC checksum is initialized before calculation.
+        [[nodiscard]]
+        PolynomialType get_initial_value() const
+        {
+            return _initial_value;
+        }
+
+        /// Returns the value with which the CRC checksum is XORed after calculation.
+        [[nodiscard]]
+        PolynomialType get_final_xor_value() const
+        {
+            return _final_xor_value;
+        }
+
+        /// Returns a const pointer to the CRC lookup table used by the instance's kernel.
         [[nodiscard]]
         const PolynomialType* get_crc_table() const
         {
-            return _crc_table;
+            return _kernel.get_table();
+        }
+
+        /// Returns true if the polynomial passed to the constructor does not match the polynomial used by the
+        /// instance's kernel. This only happens for the kernels that generate their lookup table at compile time, such
+        /// as the CRCFlashTableKernel, which always use their template polynomial.
+        [[nodiscard]]
+        bool has_polynomial_mismatch() const
+        {
+            return _polynomial_mismatch;
         }
 
     private:
         /// Stores the size of the CRC polynomial in bytes.
         static constexpr uint8_t kCRCByteLength = sizeof(PolynomialType);  // NOLINT(*-dynamic-static-initializers)
 
+        /// Determines whether the instance's kernel computes reflected (LSB-first) CRC checksums.
+        static constexpr bool kReflected = KernelType::kIsReflected;  // NOLINT(*-dynamic-static-initializers)
+
+        /// Stores the number of precomputed powers of x^8 modulo the polynomial. Supports shifting the checksum by up
+        /// to 511 zero bytes, which exceeds the size of the largest supported packet.
+        static constexpr uint8_t kShiftTableSize = 9;
+
+        /// Stores the kernel used to update the CRC checksums.
+        const KernelType _kernel;
+
         /// Stores the initial value used for the CRC checksum calculation.
         const PolynomialType _initial_value;
 
         /// Stores the final XOR value used for the CRC checksum calculation.
         const PolynomialType _final_xor_value;
 
-        /// Stores the lookup table used to speed up CRC computation at runtime.
-        PolynomialType _crc_table[256];
+        /// Tracks whether the polynomial passed to the constructor does not match the polynomial used by the kernel.
+        const bool _polynomial_mismatch;
+
+        /// Stores the values of x^(8 * 2^i) modulo the polynomial, used to shift the checksum by any number of zero
+        /// bytes.
+        PolynomialType _shift_table[kShiftTableSize];
 
         /**
-         * @brief Computes the CRC lookup table for the given polynomial and saves it to the _crc_table member.
+         * @brief Multiplies two polynomials of the CRC width and reduces the product modulo the instance's polynomial.
+         *
+         * @param multiplier The first polynomial factor.
+         * @param multiplicand The second polynomial factor.
          *
-         * @param polynomial The CRC polynomial to use for table generation.
+         * @returns the product of the two polynomials modulo the instance's polynomial.
          */
-        void GenerateCRCTable(const PolynomialType polynomial)
+        PolynomialType MultiplyModulo(const PolynomialType multiplier, const PolynomialType multiplicand) const
         {
-            // Determines the number of bits in the CRC type.
-            static constexpr size_t kCRCBits = kCRCByteLength * 8;  // NOLINT(*-dynamic-static-initializers)
-
             // Determines the Most Significant Bit (MSB) mask based on the CRC type.
-            static constexpr PolynomialType kMSBMask =             // NOLINT(*-dynamic-static-initializers)
-                static_cast<PolynomialType>(1) << (kCRCBits - 1);  // Parentheses required to avoid compiler warnings
+            static constexpr PolynomialType kMSBMask =                         // NOLINT(*-dynamic-static-initializers)
+                static_cast<PolynomialType>(1) << (kCRCByteLength * 8 - 1);  // Parentheses avoid compiler warnings
 
-            // Iterates over each possible value of a byte variable.
-            for (uint16_t byte = 0; byte < 256; ++byte)
+            // Processes the multiplier's bits starting with the MSB, using Horner's scheme: the product is multiplied
+            // by x (shifted and reduced) before adding the multiplicand for each set bit.
+            PolynomialType product = 0;
+            for (PolynomialType bit = kMSBMask; bit != 0; bit >>= 1)
             {
-                // Initializes the byte CRC value based on the CRC (Polynomial) datatype.
-                auto crc = static_cast<PolynomialType>(byte);
-
-                // Shifts the CRC value left by the appropriate number of bits based on the CRC type to align the
-                // initial value to the highest byte of the CRC variable.
-                if (kCRCBits > 8)
-                {
-                    crc <<= kCRCBits - 8;
-                }
+                product = product & kMSBMask ? static_cast<PolynomialType>(product << 1 ^ _kernel.get_polynomial())
+                                             : static_cast<PolynomialType>(product << 1);
+                if (multiplier & bit) product ^= multiplicand;
+            }
+            return product;
+        }
 
-                // Loops over each of the 8 bits making up the byte value being processed.
-                for (uint8_t bit = 0; bit < 8; ++bit)
-                {
-                    // Checks if the top bit (MSB) is set.
-                    if (crc & kMSBMask)
-                    {
-                        // Shifts the CRC value left to bring the next bit into the top position, then XORs it with
-                        // the polynomial. This simulates polynomial division where bits are checked from top to bottom.
-                        crc = static_cast<PolynomialType>(crc << 1 ^ polynomial);
-                    }
-                    else
-                    {
-                        // Shifts the CRC value left to move to the next bit without modifying the current value, as
-                        // division by the polynomial would not produce a remainder here.
-                        crc <<= 1;
-                    }
-                }
+        /// Computes the powers of x^8 modulo the instance's polynomial and saves them to the _shift_table member.
+        void GenerateShiftTable()
+        {
+            // Computes x^8 modulo the polynomial by multiplying the polynomial '1' by x 8 times. This is done without
+            // the kernel, as the kernel may store the checksums in reflected form.
+            static constexpr PolynomialType kMSBMask =                         // NOLINT(*-dynamic-static-initializers)
+                static_cast<PolynomialType>(1) << (kCRCByteLength * 8 - 1);  // Parentheses avoid compiler warnings
+            PolynomialType power = 1;
+            for (uint8_t bit = 0; bit < 8; ++bit)
+            {
+                power = power & kMSBMask ? static_cast<PolynomialType>(power << 1 ^ _kernel.get_polynomial())
+                                         : static_cast<PolynomialType>(power << 1);
+            }
+            _shift_table[0] = power;
 
-                // Stores the calculated CRC remainder for the byte value into the lookup table.
-                _crc_table[byte] = crc;
+            // Each subsequent power is the square of the previous power.
+            for (uint8_t i = 1; i < kShiftTableSize; ++i)
+            {
+                _shift_table[i] = MultiplyModulo(_shift_table[i - 1], _shift_table[i - 1]);
             }
         }
 };
@@ -0,0 +1,145 @@
+/**
+ * @file
+ *
+ * @brief Provides the FletcherProcessor class that can be used instead of the CRCProcessor class to verify transmitted
+ * data integrity by calculating the Fletcher-16 checksums for the outgoing and incoming data packets.
+ *
+ * @section fletcher_description Description:
+ * The Fletcher-16 checksum consists of two 8-bit running sums calculated modulo 255: the sum of all data bytes and the
+ * sum of all intermediate values of the first sum. Calculating the checksum only requires additions, so it is cheaper
+ * than the table-based CRC checksums on boards where each table lookup is expensive, such as AVR boards. In exchange,
+ * it detects fewer error patterns than a CRC checksum of the same width. Notably, it does not distinguish between
+ * the 0x00 and 0xFF byte values, although COBS-encoded packets never contain 0x00 bytes outside the delimiter.
+ *
+ * @section fletcher_implementation Reference Implementation:
+ * The implementation in this file is based on the implementation described in the original paper:
+ * J. Fletcher, "An Arithmetic Checksum for Serial Transmissions," in IEEE Transactions on Communications, vol. 30,
+ * no. 1, pp. 247-252, January 1982, doi: 10.1109/TCOM.1982.1095369.
+ */
+
+#ifndef AXTLMC_FLETCHER_PROCESSOR_H
+#define AXTLMC_FLETCHER_PROCESSOR_H
+
+// Dependencies
+#include <Arduino.h>
+
+/**
+ * @brief Provides methods for calculating Fletcher-16 checksums and using them to verify the integrity of the incoming
+ * and outgoing data packets.
+ *
+ * This class implements the checksum engine interface used by the TransportLayer class. To use it, specify it as the
+ * ChecksumEngineType template argument of a TransportLayer class that uses the uint16_t PolynomialType. The running
+ * checksum stores the second sum in its high byte and the first sum in its low byte. The same layout is used by the
+ * finalized checksum, which is transmitted starting with the second sum.
+ *
+ * @warning This class is intended to be used by the TransportLayer class and should not be used directly by the
+ * end-users.
+ */
+class FletcherProcessor final
+{
+    public:
+        /// The datatype of the Fletcher-16 checksums computed by the processor.
+        using ChecksumType = uint16_t;
+
+        /// The size of the Fletcher-16 checksum postamble, in bytes.
+        static constexpr uint8_t kChecksumSize = 2;
+
+        /**
+         * @brief Initializes the processor.
+         *
+         * The Fletcher-16 checksum does not use a polynomial, an initial value, or a final XOR value. The parameters
+         * are accepted to support the constructor interface expected by the TransportLayer class and are ignored.
+         */
+        explicit FletcherProcessor(
+            const uint16_t polynomial      = 0,
+            const uint16_t initial_value   = 0,
+            const uint16_t final_xor_value = 0
+        )
+        {
+            static_cast<void>(polynomial);
+            static_cast<void>(initial_value);
+            static_cast<void>(final_xor_value);
+        }
+
+        /**
+         * @brief Updates the running Fletcher-16 checksum with the input data bytes.
+         *
+         * To reduce the number of modulo operations, the method accumulates up to kBlockSize bytes in 16-bit sums
+         * before partially reducing the sums modulo 255 by adding their high and low bytes together.
+         *
+         * @param checksum The running Fletcher-16 checksum to update.
+         * @param data The pointer to the data bytes to add to the checksum.
+         * @param size The number of data bytes to add to the checksum.
+         *
+         * @returns the updated running Fletcher-16 checksum.
+         */
+        static uint16_t UpdateChecksum(const uint16_t checksum, const uint8_t* data, uint16_t size)
+        {
+            uint16_t first_sum  = checksum & 0xFF;
+            uint16_t second_sum = checksum >> 8;
+            while (size > 0)
+            {
+                uint8_t block_size = size < kBlockSize ? size : kBlockSize;
+                size -= block_size;
+                do
+                {
+                    first_sum += *data++;
+                    second_sum += first_sum;
+                } while (--block_size != 0);
+
+                // Each partial reduction preserves the sum's value modulo 255. Two reductions are needed to bring the
+                // 16-bit sums back to the 0 to 255 range, where 255 is equivalent to 0.
+                first_sum  = (first_sum & 0xFF) + (first_sum >> 8);
+                first_sum  = (first_sum & 0xFF) + (first_sum >> 8);
+                second_sum = (second_sum & 0xFF) + (second_sum >> 8);
+                second_sum = (second_sum & 0xFF) + (second_sum >> 8);
+            }
+            return static_cast<uint16_t>(second_sum << 8 | first_sum);
+        }
+
+        /**
+         * @brief Finalizes the running Fletcher-16 checksum by fully reducing both sums modulo 255.
+         *
+         * @param checksum The running Fletcher-16 checksum calculated over all data bytes.
+         *
+         * @returns the final Fletcher-16 checksum to be transmitted with the data.
+         */
+        [[nodiscard]]
+        static uint16_t FinalizeChecksum(const uint16_t checksum)
+        {
+            uint8_t first_sum  = checksum & 0xFF;
+            uint8_t second_sum = checksum >> 8;
+            if (first_sum == 255) first_sum = 0;
+            if (second_sum == 255) second_sum = 0;
+            return static_cast<uint16_t>(second_sum << 8 | first_sum);
+        }
+
+        /**
+         * @brief Determines whether the running Fletcher-16 checksum calculated over the received data matches the
+         * checksum received with the data.
+         *
+         * @param checksum The running (not finalized) Fletcher-16 checksum calculated over all received data bytes.
+         * @param received_checksum The checksum received with the data.
+         *
+         * @returns true if the checksums match, indicating that the data is intact, and false otherwise.
+         */
+        [[nodiscard]]
+        static bool VerifyChecksum(const uint16_t checksum, const uint16_t received_checksum)
+        {
+            return FinalizeChecksum(checksum) == received_checksum;
+        }
+
+        /// Returns the value to which the Fletcher-16 checksum is initialized before calculation.
+        [[nodiscard]]
+        static constexpr uint16_t get_initial_value()
+        {
+            return 0;
+        }
+
+    private:
+        /// Stores the maximum number of bytes that can be added to the 16-bit sums without overflowing them. The
+        /// second sum can reach 255 + 255 * n + 255 * n * (n + 1) / 2, which stays below 65536 for n <= 21.
+        static constexpr uint8_t kBlockSize = 20;
+};
+
+#endif  //AXTLMC_FLETCHER_PROCESSOR_H
@@ -0,0 +1,313 @@
+/**
+ * @file
+ *
+ * @brief Provides the InterruptReceiver class that frames the incoming packets as their bytes are received, so that
+ * the application's loop only has to verify and decode complete packets.
+ *
+ * @section ir_description Description:
+ * When the TransportLayer class is polled from the application's loop, each packet waits up to one loop period before
+ * its bytes are parsed. The InterruptReceiver class moves the packet framing (finding the start byte, the payload size
+ * byte, the delimiter byte, and the postamble) into the context that receives the bytes, such as a UART interrupt
+ * service routine or the serialEvent() callback. Each byte advances the framing state machine by one step without
+ * blocking, and every complete packet is published to the application's loop through a lock-free SpscRing queue. The
+ * loop then passes the framed packets to the wrapped TransportLayer instance, which verifies their checksums and
+ * decodes their payloads.
+ *
+ * @warning Each queue slot reserves the wrapped TransportLayer instance's reception buffer size of RAM. On boards with
+ * limited RAM, such as Arduino Mega, reduce the queue capacity or the TransportLayer's kMaximumReceivedPayloadSize
+ * template parameter accordingly.
+ */
+
+#ifndef AXTLMC_INTERRUPT_RECEIVER_H
+#define AXTLMC_INTERRUPT_RECEIVER_H
+
+#include <Arduino.h>
+#include "axtlmc_shared_assets.h"
+#include "spsc_ring.h"
+
+using namespace axtlmc_shared_assets;
+
+/**
+ * @brief Frames the packets received by the producer context (an interrupt service routine or the serialEvent()
+ * callback) and passes them to the wrapped TransportLayer instance in the consumer context (the application's loop).
+ *
+ * @warning The IngestByte() and Ingest() methods must only be called from a single producer context, and the
+ * ReceiveData() method must only be called from a single consumer context. The wrapped TransportLayer instance's
+ * ReceiveData() method must not be used while the instance is wrapped by this class.
+ *
+ * @tparam TransportType The type of the wrapped TransportLayer instance.
+ * @tparam kCapacity The maximum number of framed packets waiting to be processed by the consumer. Must be a power of
+ * two between 1 and 128.
+ */
+template <typename TransportType, const uint8_t kCapacity = 4>
+class InterruptReceiver final
+{
+        // The framing state machine relies on the payload size field to find the end of each packet, which the
+        // delimiter-framed layouts do not transmit.
+        static_assert(
+            !TransportType::Layout::kIsDelimiterFramed,
+            "InterruptReceiver does not support delimiter-framed TransportLayer LayoutTypes."
+        );
+
+    public:
+        /**
+         * @brief Initializes the instance's framing state machine.
+         *
+         * @param transport_layer The TransportLayer instance used to verify and decode the framed packets. The
+         * instance's inter-byte timeout is copied when this class is initialized and is used to abandon stalled
+         * packets.
+         */
+        explicit InterruptReceiver(TransportType& transport_layer) :
+            _transport(transport_layer),
+            _inter_byte_timeout(transport_layer.get_inter_byte_timeout())
+        {}
+
+        /**
+         * @brief Advances the framing state machine with the input byte.
+         *
+         * This method never blocks, so it is safe to call from an interrupt service routine. Once the byte completes
+         * a packet, the packet is published to the consumer. If the queue is full, the packet is dropped and counted
+         * as such.
+         *
+         * @note If more than the wrapped TransportLayer instance's inter-byte timeout has passed since the previous
+         * byte, the partially framed packet is abandoned and the byte is processed as if it was the first received
+         * byte.
+         *
+         * @param value The received byte.
+         */
+        void IngestByte(const uint8_t value)
+        {
+            // Abandons the stalled packet.
+            const uint32_t now = micros();
+            if (_state != kInitialState && now - _last_byte_time > _inter_byte_timeout)
+            {
+                CountFramingError();
+            }
+            _last_byte_time = now;
+
+            switch (_state)
+            {
+                case kFramingStates::kStartByteSearch:
+                    if (value == Layout::kStartByte) _state = kFramingStates::kPayloadSize;
+                    return;
+
+                case kFramingStates::kPayloadSize:
+                    // Discards the packets whose payload size is outside the expected range.
+                    if (value < Layout::kMinimumPayloadSize + TransportType::get_sequence_number_size() ||
+                        value > TransportType::get_maximum_received_payload_size() +
+                                    TransportType::get_sequence_number_size())
+                    {
+                        CountFramingError();
+                        return;
+                    }
+
+                    // Discards the packet if the consumer has not yet released any queue slot.
+                    _packet = _queue.get_write_slot();
+                    if (_packet == nullptr)
+                    {
+                        StoreRelease(_dropped_packets, _dropped_packets + 1);
+                        _state = kInitialState;
+                        return;
+                    }
+
+                    _packet->data[0] = value;
+                    _packet->size    = 1;
+                    _delimiter_index = value + Layout::kPayloadStartIndex - Layout::kPayloadSizeIndex;
+                    _state           = Layout::kPayloadSizeWidth > 1 ? kFramingStates::kPayloadSizeUpper
+                                                                     : kFramingStates::kPacketBody;
+                    return;
+
+                case kFramingStates::kPayloadSizeUpper:
+                    // The upper byte of the 2-byte payload size field must be 0, as COBS limits the payloads to 254
+                    // bytes.
+                    if (value != 0)
+                    {
+                        CountFramingError();
+                        return;
+                    }
+
+                    _packet->data[_packet->size++] = value;
+                    _state                         = kFramingStates::kPacketBody;
+                    return;
+
+                case kFramingStates::kPacketBody:
+                    _packet->data[_packet->size] = value;
+
+                    // The only unencoded delimiter byte value must be found at the end of the packet's data.
+                    if ((value == Layout::kDelimiterByte) != (_packet->size == _delimiter_index))
+                    {
+                        CountFramingError();
+                        return;
+                    }
+
+                    _packet->size++;
+                    if (value == Layout::kDelimiterByte) _state = kFramingStates::kPostamble;
+                    return;
+
+                case kFramingStates::kPostamble:
+                    _packet->data[_packet->size++] = value;
+                    if (_packet->size == _delimiter_index + 1 + TransportType::get_postamble_size())
+                    {
+                        _queue.CommitWrite();
+                        StoreRelease(_framed_packets, _framed_packets + 1);
+                        _state = kInitialState;
+                    }
+                    return;
+            }
+        }
+
+        /**
+         * @brief Advances the framing state machine with all bytes available from the input communication interface.
+         *
+         * This method is intended to be called from the serialEvent() callback or a similar context that runs when
+         * the communication interface receives new bytes.
+         *
+         * @param port The communication interface to read the bytes from.
+         * @returns the number of bytes read from the communication interface.
+         */
+        uint16_t Ingest(Stream& port)
+        {
+            uint16_t bytes_read = 0;
+            while (port.available() > 0)
+            {
+                IngestByte(static_cast<uint8_t>(port.read()));
+                bytes_read++;
+            }
+            return bytes_read;
+        }
+
+        /**
+         * @brief Passes the oldest framed packet to the wrapped TransportLayer instance, which verifies its integrity
+         * and decodes its payload into the instance's reception buffer.
+         *
+         * Once this method returns true, the payload can be read using the wrapped TransportLayer instance's
+         * ReadData() method.
+         *
+         * @returns true if the packet was successfully verified and unpacked, or false if no framed packet is
+         * available or the packet is corrupted.
+         */
+        bool ReceiveData()
+        {
+            const FramedPacket* packet = _queue.get_read_slot();
+            if (packet == nullptr)
+            {
+                _runtime_status = static_cast<uint8_t>(kInterruptReceiverStatusCodes::kNoPacketsFramed);
+                return false;
+            }
+
+            // The packet is copied into the TransportLayer's reception buffer, so the slot can be released right away.
+            const bool received = _transport.ReceiveFramedPacket(packet->data, packet->size);
+            _queue.CommitRead();
+
+            _runtime_status = static_cast<uint8_t>(
+                received ? kInterruptReceiverStatusCodes::kPacketReceived
+                         : kInterruptReceiverStatusCodes::kPacketRejected
+            );
+            return received;
+        }
+
+        /// Returns the number of framed packets waiting to be processed by the ReceiveData() method.
+        [[nodiscard]]
+        uint8_t get_pending_packets() const
+        {
+            return _queue.get_size();
+        }
+
+        /// Returns the number of packets published to the consumer since the instance was initialized.
+        [[nodiscard]]
+        uint32_t get_framed_packets() const
+        {
+            return LoadAcquire(_framed_packets);
+        }
+
+        /// Returns the number of framed packets dropped because the queue was full since the instance was initialized.
+        [[nodiscard]]
+        uint32_t get_dropped_packets() const
+        {
+            return LoadAcquire(_dropped_packets);
+        }
+
+        /// Returns the number of partially framed packets abandoned due to framing errors or stalling since the
+        /// instance was initialized.
+        [[nodiscard]]
+        uint32_t get_framing_errors() const
+        {
+            return LoadAcquire(_framing_errors);
+        }
+
+        /// Returns the runtime status of the most recently called ReceiveData() method.
+        [[nodiscard]]
+        uint8_t get_runtime_status() const
+        {
+            return _runtime_status;
+        }
+
+    private:
+        /// Defines the states of the framing state machine.
+        enum class kFramingStates : uint8_t
+        {
+            kStartByteSearch  = 0,  ///< Discards the received bytes until the start byte is found.
+            kPayloadSize      = 1,  ///< Expects the payload size byte (the lower byte of the 2-byte size fields).
+            kPayloadSizeUpper = 2,  ///< Expects the upper byte of the 2-byte payload size field.
+            kPacketBody       = 3,  ///< Expects the COBS-encoded packet bytes that end with the delimiter byte.
+            kPostamble        = 4,  ///< Expects the checksum postamble bytes.
+        };
+
+        /// Stores the PacketLayout of the framed packets.
+        using Layout = typename TransportType::Layout;
+
+        /// Stores the state from which the framing of each packet begins. Layouts without the start byte begin each
+        /// packet with the payload size field.
+        static constexpr kFramingStates kInitialState =
+            Layout::kHasStartByte ? kFramingStates::kStartByteSearch : kFramingStates::kPayloadSize;
+
+        /// Stores a single framed packet.
+        struct FramedPacket
+        {
+                /// The framed packet bytes.
+                uint8_t data[TransportType::get_reception_buffer_size() - Layout::kPayloadSizeIndex];
+                uint16_t size = 0;  ///< The number of framed packet bytes.
+        };
+
+        /// Abandons the partially framed packet.
+        void CountFramingError()
+        {
+            StoreRelease(_framing_errors, _framing_errors + 1);
+            _state = kInitialState;
+        }
+
+        /// The reference to the TransportLayer instance that verifies and decodes the framed packets.
+        TransportType& _transport;
+
+        /// Stores the framed packets waiting to be processed by the consumer.
+        SpscRing<FramedPacket, kCapacity> _queue;
+
+        /// Stores the maximum number of microseconds that can pass between two consecutive bytes of the packet.
+        const uint32_t _inter_byte_timeout;
+
+        /// Stores the time, in microseconds, at which the previous byte was received. Only used by the producer.
+        uint32_t _last_byte_time = 0;
+
+        /// Stores the current state of the framing state machine. Only used by the producer.
+        kFramingStates _state = kInitialState;
+
+        /// Stores the pointer to the queue slot that receives the currently framed packet. Only used by the producer.
+        FramedPacket* _packet = nullptr;
+
+        /// Stores the index of the delimiter byte inside the currently framed packet. Only used by the producer.
+        uint16_t _delimiter_index = 0;
+
+        /// Tracks the number of packets published to the consumer. Only modified by the producer.
+        uint32_t _framed_packets = 0;
+
+        /// Tracks the number of packets dropped because the queue was full. Only modified by the producer.
+        uint32_t _dropped_packets = 0;
+
+        /// Tracks the number of abandoned partially framed packets. Only modified by the producer.
+        uint32_t _framing_errors = 0;
+
+        /// Stores the runtime status of the most recently called ReceiveData() method. Only used by the consumer.
+        uint8_t _runtime_status = static_cast<uint8_t>(kInterruptReceiverStatusCodes::kStandby);
+};
+
+#endif  //AXTLMC_INTERRUPT_RECEIVER_H
@@ -0,0 +1,196 @@
+/**
+ * @file
+ *
+ * @brief Provides the LatencyHistogram class that records the distribution of packet transmission and reception
+ * latencies without allocating memory at runtime.
+ *
+ * @section lh_description Description:
+ * The average latency hides the rare slow packets that disrupt closed-loop runtimes. The LatencyHistogram class counts
+ * the recorded latencies in fixed buckets whose widths double with each bucket (log2 buckets), so that a small,
+ * statically allocated histogram covers the full range of 32-bit microsecond latencies with a constant relative
+ * resolution. The histograms can be attached to a TransportLayer instance to time its packets and can be sent to the
+ * PC as regular packets, which allows collecting the latency percentiles during real sessions.
+ *
+ * @section lh_packet_anatomy Payload Anatomy:
+ * The Send() method transmits the histogram as one or more packets that use the following payload layout:
+ * [PACKET TYPE] [HISTOGRAM ID] [FIRST BUCKET] [BUCKET COUNT] [TOTAL COUNT] [MAXIMUM] [BUCKET COUNTS]
+ *
+ * The packet type is kReservedPacketTypes::kLatencyHistogram. The first bucket and the bucket count are single bytes
+ * that describe the range of buckets stored in the packet. The total count, the maximum recorded latency and each
+ * bucket count are little-endian 32-bit values.
+ */
+
+#ifndef AXTLMC_LATENCY_HISTOGRAM_H
+#define AXTLMC_LATENCY_HISTOGRAM_H
+
+#include <Arduino.h>
+#include "axtlmc_shared_assets.h"
+
+using namespace axtlmc_shared_assets;
+
+/**
+ * @brief Counts the recorded latencies in log2 buckets.
+ *
+ * Bucket 0 counts the latencies of 0 microseconds, and each bucket 'i' above 0 counts the latencies between 2^(i-1)
+ * and 2^i - 1 microseconds, inclusive.
+ */
+class LatencyHistogram final
+{
+    public:
+        /// The number of buckets used by the histogram.
+        static constexpr uint8_t kBucketCount = 33;
+
+        /// Initializes all buckets to zero.
+        LatencyHistogram() = default;
+
+        /**
+         * @brief Adds the input latency to the histogram.
+         *
+         * @param latency The latency to record, in microseconds.
+         */
+        void Record(const uint32_t latency)
+        {
+            _buckets[GetBucketIndex(latency)]++;
+            _count++;
+            if (latency > _maximum) _maximum = latency;
+        }
+
+        /// Discards all recorded latencies.
+        void Reset()
+        {
+            memset(_buckets, 0, sizeof(_buckets));
+            _count   = 0;
+            _maximum = 0;
+        }
+
+        /**
+         * @brief Estimates the latency below or at which the requested percentage of the recorded latencies fall.
+         *
+         * @param percentile The requested percentage, from 0 to 100.
+         * @returns the upper bound of the bucket that contains the requested percentile, capped at the maximum recorded
+         * latency, or 0 if no latencies were recorded.
+         */
+        [[nodiscard]]
+        uint32_t GetPercentile(const float percentile) const
+        {
+            if (_count == 0) return 0;
+
+            // Finds the first bucket at which the cumulative count reaches the requested rank.
+            auto rank = static_cast<uint32_t>(percentile / 100.0F * static_cast<float>(_count) + 0.5F);
+            if (rank == 0) rank = 1;
+            uint32_t cumulative_count = 0;
+            for (uint8_t i = 0; i < kBucketCount; i++)
+            {
+                cumulative_count += _buckets[i];
+                if (cumulative_count >= rank)
+                {
+                    const uint32_t upper_bound = GetBucketUpperBound(i);
+                    return upper_bound < _maximum ? upper_bound : _maximum;
+                }
+            }
+            return _maximum;
+        }
+
+        /**
+         * @brief Sends the histogram to the PC using the input TransportLayer instance.
+         *
+         * If the histogram does not fit into a single packet, it is split into multiple packets that store consecutive
+         * bucket ranges. See the file documentation for the payload layout of the sent packets.
+         *
+         * @note The packets are sent with the scatter-gather SendData() method, so the payload staged in the
+         * TransportLayer instance's transmission buffer is preserved.
+         *
+         * @tparam TransportType The type of the TransportLayer instance used to send the histogram.
+         * @param transport_layer The TransportLayer instance used to send the histogram.
+         * @param histogram_id The identifier that allows the PC to tell apart multiple histograms.
+         * @returns true if all packets were sent and false otherwise.
+         */
+        template <typename TransportType>
+        bool Send(TransportType& transport_layer, const uint8_t histogram_id) const
+        {
+            static_assert(
+                TransportType::get_maximum_transmitted_payload_size() >= kHeaderSize + sizeof(uint32_t),
+                "LatencyHistogram::Send() requires the TransportLayer's kMaximumTransmittedPayloadSize template "
+                "parameter to be at least 16."
+            );
+            constexpr uint8_t kBucketsPerPacket =
+                (TransportType::get_maximum_transmitted_payload_size() - kHeaderSize) / sizeof(uint32_t);
+
+            for (uint8_t first_bucket = 0; first_bucket < kBucketCount; first_bucket += kBucketsPerPacket)
+            {
+                const uint8_t remaining_buckets = kBucketCount - first_bucket;
+                const uint8_t bucket_count =
+                    remaining_buckets < kBucketsPerPacket ? remaining_buckets : kBucketsPerPacket;
+
+                uint8_t header[kHeaderSize] = {
+                    kReservedPacketTypes::kLatencyHistogram,
+                    histogram_id,
+                    first_bucket,
+                    bucket_count
+                };
+                memcpy(&header[4], &_count, sizeof(_count));
+                memcpy(&header[8], &_maximum, sizeof(_maximum));
+
+                const DataSegment segments[] = {
+                    {header, kHeaderSize},
+                    {&_buckets[first_bucket], static_cast<uint16_t>(bucket_count * sizeof(uint32_t))}
+                };
+                if (!transport_layer.SendData(segments)) return false;
+            }
+            return true;
+        }
+
+        /// Returns the number of latencies recorded in the bucket with the input index.
+        [[nodiscard]]
+        uint32_t get_bucket(const uint8_t index) const
+        {
+            return index < kBucketCount ? _buckets[index] : 0;
+        }
+
+        /// Returns the total number of recorded latencies.
+        [[nodiscard]]
+        uint32_t get_count() const
+        {
+            return _count;
+        }
+
+        /// Returns the largest recorded latency, in microseconds.
+        [[nodiscard]]
+        uint32_t get_maximum() const
+        {
+            return _maximum;
+        }
+
+        /// Returns the index of the bucket that counts the input latency.
+        [[nodiscard]]
+        static uint8_t GetBucketIndex(const uint32_t latency)
+        {
+            // The bucket index is the number of significant bits in the latency.
+            if (latency == 0) return 0;
+            constexpr uint8_t kLongBits = sizeof(unsigned long) * 8;
+            return static_cast<uint8_t>(kLongBits - __builtin_clzl(latency));
+        }
+
+        /// Returns the largest latency, in microseconds, counted by the bucket with the input index.
+        [[nodiscard]]
+        static uint32_t GetBucketUpperBound(const uint8_t index)
+        {
+            if (index >= kBucketCount - 1) return 0xFFFFFFFF;
+            return (static_cast<uint32_t>(1) << index) - 1;
+        }
+
+    private:
+        /// Stores the size of the header that precedes the bucket counts in each sent packet, in bytes.
+        static constexpr uint8_t kHeaderSize = 12;
+
+        /// Stores the number of latencies recorded in each bucket.
+        uint32_t _buckets[kBucketCount] {};
+
+        /// Stores the total number of recorded latencies.
+        uint32_t _count = 0;
+
+        /// Stores the largest recorded latency, in microseconds.
+        uint32_t _maximum = 0;
+};
+
+#endif  //AXTLMC_LATENCY_HISTOGRAM_H
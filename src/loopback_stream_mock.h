@@ -0,0 +1,383 @@
+/**
+ * @file
+ *
+ * @brief Provides the LoopbackStreamPair class used to connect two simulated Serial Stream interfaces through lossy,
+ * bandwidth-limited channels for throughput and error-recovery testing of the TransportLayer class.
+ *
+ * @section lsm_description Description:
+ * Each LoopbackStreamPair instance contains two LoopbackStreamMock endpoints connected back-to-back: the bytes written
+ * to one endpoint are received by the other endpoint. Each transfer direction is modeled by a ChannelSimulator
+ * instance that stores the bytes in transit in a ring buffer and can drop, corrupt (flip), and insert bytes, inject
+ * error bursts, and limit the transfer rate to the one supported by the simulated baud rate.
+ *
+ * @note All impairments are driven by a seeded pseudo-random number generator, so the same seed and configuration
+ * always produce the same error pattern for the same data stream.
+ */
+
+#ifndef AXTLMC_LOOPBACK_STREAM_MOCK_H
+#define AXTLMC_LOOPBACK_STREAM_MOCK_H
+
+#include <Arduino.h>
+#include <Stream.h>
+
+/**
+ * @struct ChannelImpairments
+ * @brief Stores the parameters that control the impairments applied by the ChannelSimulator class to the transferred
+ * bytes.
+ *
+ * All probabilities are evaluated independently for each byte written to the channel and must be between 0 and 1.
+ */
+struct ChannelImpairments
+{
+        float drop_probability   = 0;  ///< The probability of discarding the byte.
+        float flip_probability   = 0;  ///< The probability of inverting a random bit of the byte.
+        float insert_probability = 0;  ///< The probability of inserting a random byte after the byte.
+        float burst_probability  = 0;  ///< The probability of starting an error burst at the byte.
+        uint16_t burst_length    = 0;  ///< The number of consecutive bytes corrupted by each error burst.
+        uint32_t baud_rate       = 0;  ///< The simulated baud rate (8N1 framing). 0 disables the rate limit.
+};
+
+/**
+ * @struct ChannelStatistics
+ * @brief Stores the counters that track the bytes processed by the ChannelSimulator class.
+ */
+struct ChannelStatistics
+{
+        uint32_t bytes_written   = 0;  ///< The number of bytes written to the channel by the transmitting endpoint.
+        uint32_t bytes_delivered = 0;  ///< The number of bytes read from the channel by the receiving endpoint.
+        uint32_t bytes_dropped   = 0;  ///< The number of bytes discarded by the channel.
+        uint32_t bytes_flipped   = 0;  ///< The number of bytes corrupted by the channel, including error bursts.
+        uint32_t bytes_inserted  = 0;  ///< The number of random bytes inserted by the channel.
+        uint32_t bytes_overflown = 0;  ///< The number of bytes discarded because the channel's buffer was full.
+};
+
+/**
+ * @brief Simulates a one-directional serial communication line by storing the bytes in transit in a ring buffer and
+ * applying the configured impairments to them.
+ *
+ * @tparam kCapacity The size of the ring buffer, in bytes. This is the maximum number of bytes that can be in transit
+ * at the same time. Bytes written to a full channel are discarded, similar to an overflowing hardware buffer.
+ */
+template <const uint16_t kCapacity = 512>
+class ChannelSimulator final
+{
+        static_assert(kCapacity > 0, "ChannelSimulator capacity must be greater than zero.");
+
+    public:
+        /// Initializes the instance with no impairments and the default pseudo-random number generator seed.
+        ChannelSimulator() = default;
+
+        /**
+         * @brief Configures the impairments applied to all bytes written to the channel after this call.
+         *
+         * @param impairments The impairment parameters to use.
+         * @param seed The seed for the pseudo-random number generator that drives the impairments. Must not be 0.
+         */
+        void SetImpairments(const ChannelImpairments& impairments, const uint32_t seed = 0x9E3779B9)
+        {
+            _drop_threshold   = ConvertProbability(impairments.drop_probability);
+            _flip_threshold   = ConvertProbability(impairments.flip_probability);
+            _insert_threshold = ConvertProbability(impairments.insert_probability);
+            _burst_threshold  = ConvertProbability(impairments.burst_probability);
+            _burst_length     = impairments.burst_length;
+            _bytes_per_second = impairments.baud_rate / 10;
+            _random_state     = seed != 0 ? seed : 0x9E3779B9;
+            _burst_remaining  = 0;
+            _last_release     = micros();
+            _release_credit   = 0;
+        }
+
+        /**
+         * @brief Writes the input byte to the channel, applying the configured impairments.
+         *
+         * @param value The byte to write.
+         */
+        void Write(uint8_t value)
+        {
+            _statistics.bytes_written++;
+
+            if (_drop_threshold != 0 && NextRandom() < _drop_threshold)
+            {
+                _statistics.bytes_dropped++;
+                return;
+            }
+
+            // Starts a new error burst or corrupts the byte with the single-byte flip probability.
+            if (_burst_remaining == 0 && _burst_threshold != 0 && NextRandom() < _burst_threshold)
+            {
+                _burst_remaining = _burst_length;
+            }
+            if (_burst_remaining > 0)
+            {
+                _burst_remaining--;
+                value ^= static_cast<uint8_t>(NextRandom() | 1);  // Always changes at least one bit.
+                _statistics.bytes_flipped++;
+            }
+            else if (_flip_threshold != 0 && NextRandom() < _flip_threshold)
+            {
+                value ^= static_cast<uint8_t>(1 << (NextRandom() & 7));
+                _statistics.bytes_flipped++;
+            }
+
+            Push(value);
+
+            if (_insert_threshold != 0 && NextRandom() < _insert_threshold)
+            {
+                Push(static_cast<uint8_t>(NextRandom()));
+                _statistics.bytes_inserted++;
+            }
+        }
+
+        /// Returns the number of bytes that have arrived at the receiving end of the channel and can be read.
+        uint16_t Available()
+        {
+            Release();
+            return _released;
+        }
+
+        /// Returns the number of bytes that can be written to the channel before its buffer overflows.
+        [[nodiscard]]
+        uint16_t AvailableForWrite() const
+        {
+            return kCapacity - _size;
+        }
+
+        /// Reads and consumes the next byte that has arrived at the receiving end of the channel. Returns -1 if no
+        /// bytes have arrived.
+        int Read()
+        {
+            if (Available() == 0) return -1;
+            const uint8_t value = _buffer[_head];
+            _head               = (_head + 1) % kCapacity;
+            _size--;
+            _released--;
+            _statistics.bytes_delivered++;
+            return value;
+        }
+
+        /// Returns the next byte that has arrived at the receiving end of the channel without consuming it. Returns -1
+        /// if no bytes have arrived.
+        int Peek()
+        {
+            if (Available() == 0) return -1;
+            return _buffer[_head];
+        }
+
+        /// Discards all bytes in transit and resets the bandwidth accounting.
+        void Clear()
+        {
+            _head           = 0;
+            _size           = 0;
+            _released       = 0;
+            _release_credit = 0;
+            _last_release   = micros();
+        }
+
+        /// Returns the counters that track the bytes processed by the channel.
+        [[nodiscard]]
+        const ChannelStatistics& get_statistics() const
+        {
+            return _statistics;
+        }
+
+    private:
+        /// Stores the bytes in transit.
+        uint8_t _buffer[kCapacity] {};
+
+        /// Stores the index of the oldest byte in transit.
+        uint16_t _head = 0;
+
+        /// Stores the number of bytes in transit.
+        uint16_t _size = 0;
+
+        /// Stores the number of bytes in transit that have arrived at the receiving end of the channel.
+        uint16_t _released = 0;
+
+        /// Stores the thresholds that the pseudo-random numbers are compared against to trigger each impairment.
+        uint32_t _drop_threshold   = 0;
+        uint32_t _flip_threshold   = 0;
+        uint32_t _insert_threshold = 0;
+        uint32_t _burst_threshold  = 0;
+
+        /// Stores the number of bytes corrupted by each error burst.
+        uint16_t _burst_length = 0;
+
+        /// Stores the number of bytes left to corrupt in the ongoing error burst.
+        uint16_t _burst_remaining = 0;
+
+        /// Stores the number of bytes the channel transfers per second. 0 disables the rate limit.
+        uint32_t _bytes_per_second = 0;
+
+        /// Stores the micros() timestamp of the last bandwidth accounting update.
+        uint32_t _last_release = 0;
+
+        /// Accumulates the elapsed time not yet converted into transferred bytes, in byte-microseconds.
+        uint64_t _release_credit = 0;
+
+        /// Stores the state of the xorshift32 pseudo-random number generator.
+        uint32_t _random_state = 0x9E3779B9;
+
+        /// Stores the counters that track the bytes processed by the channel.
+        ChannelStatistics _statistics;
+
+        /// Converts the input probability into the threshold compared against the pseudo-random numbers.
+        static uint32_t ConvertProbability(const float probability)
+        {
+            if (probability <= 0) return 0;
+            if (probability >= 1) return UINT32_MAX;
+            return static_cast<uint32_t>(probability * 4294967295.0);
+        }
+
+        /// Advances the xorshift32 pseudo-random number generator and returns the generated number.
+        uint32_t NextRandom()
+        {
+            _random_state ^= _random_state << 13;
+            _random_state ^= _random_state >> 17;
+            _random_state ^= _random_state << 5;
+            return _random_state;
+        }
+
+        /// Adds the input byte to the end of the ring buffer, discarding it if the buffer is full.
+        void Push(const uint8_t value)
+        {
+            if (_size == kCapacity)
+            {
+                _statistics.bytes_overflown++;
+                return;
+            }
+            // Brings the arrived bytes up to date, as the reader may not have polled the channel since the previous
+            // write. If all bytes in transit have arrived at the receiving end, the channel was idle, so the transfer
+            // of this byte starts now rather than when the previous bytes finished arriving.
+            Release();
+            if (_released == _size)
+            {
+                _last_release   = micros();
+                _release_credit = 0;
+            }
+
+            _buffer[(_head + _size) % kCapacity] = value;
+            _size++;
+
+            // Without a rate limit, the bytes arrive at the receiving end immediately.
+            if (_bytes_per_second == 0) _released = _size;
+        }
+
+        /// Makes the bytes that would have been transferred by now at the simulated baud rate available for reading.
+        void Release()
+        {
+            if (_bytes_per_second == 0 || _released == _size)
+            {
+                _last_release = micros();
+                return;
+            }
+
+            const uint32_t now = micros();
+            _release_credit += static_cast<uint64_t>(now - _last_release) * _bytes_per_second;
+            _last_release = now;
+
+            const uint64_t transferred = _release_credit / 1000000;
+            const uint16_t pending     = _size - _released;
+            if (transferred >= pending)
+            {
+                _released       = _size;
+                _release_credit = 0;
+            }
+            else
+            {
+                _released += static_cast<uint16_t>(transferred);
+                _release_credit -= transferred * 1000000;
+            }
+        }
+};
+
+/**
+ * @brief Simulates a Serial Stream interface that transmits and receives data through two ChannelSimulator instances.
+ *
+ * @tparam kCapacity The size of the ring buffer used by each channel, in bytes.
+ */
+template <const uint16_t kCapacity = 512>
+class LoopbackStreamMock final : public Stream
+{
+    public:
+        /**
+         * @brief Connects the instance to the reception and transmission channels.
+         *
+         * @param reception_channel The channel from which the instance reads the received data.
+         * @param transmission_channel The channel to which the instance writes the transmitted data.
+         */
+        LoopbackStreamMock(
+            ChannelSimulator<kCapacity>& reception_channel,
+            ChannelSimulator<kCapacity>& transmission_channel
+        ) :
+            _reception_channel(reception_channel), _transmission_channel(transmission_channel)
+        {}
+
+        /// Returns the number of bytes that have arrived through the reception channel.
+        int available() override
+        {
+            return _reception_channel.Available();
+        }
+
+        /// Reads one byte from the reception channel. Returns -1 if no bytes are available.
+        int read() override
+        {
+            return _reception_channel.Read();
+        }
+
+        /// Returns the next byte from the reception channel without consuming it. Returns -1 if no bytes are available.
+        int peek() override
+        {
+            return _reception_channel.Peek();
+        }
+
+        /// Writes the input byte to the transmission channel. Always returns 1, as lost bytes are indistinguishable
+        /// from transmitted bytes for the writer.
+        size_t write(const uint8_t value) override
+        {
+            _transmission_channel.Write(value);
+            return 1;
+        }
+
+        /// Writes the requested number of bytes from the input buffer to the transmission channel.
+        size_t write(const uint8_t* buffer, const size_t bytes_to_write) override
+        {
+            for (size_t index = 0; index < bytes_to_write; ++index) _transmission_channel.Write(buffer[index]);
+            return bytes_to_write;
+        }
+
+        /// Returns the number of bytes that can be written before the transmission channel overflows.
+        int availableForWrite() override
+        {
+            return _transmission_channel.AvailableForWrite();
+        }
+
+        /// Does nothing, as the transmission channel does not buffer the written data outside the simulated line.
+        void flush() override
+        {}
+
+    private:
+        /// The channel from which the instance reads the received data.
+        ChannelSimulator<kCapacity>& _reception_channel;
+
+        /// The channel to which the instance writes the transmitted data.
+        ChannelSimulator<kCapacity>& _transmission_channel;
+};
+
+/**
+ * @brief Provides two LoopbackStreamMock endpoints connected back-to-back through two ChannelSimulator instances.
+ *
+ * The data written to port_a is received by port_b through the a_to_b channel, and the data written to port_b is
+ * received by port_a through the b_to_a channel.
+ *
+ * @tparam kCapacity The size of the ring buffer used by each channel, in bytes.
+ */
+template <const uint16_t kCapacity = 512>
+struct LoopbackStreamPair
+{
+        ChannelSimulator<kCapacity> a_to_b;                    ///< Transfers the data written to port_a to port_b.
+        ChannelSimulator<kCapacity> b_to_a;                    ///< Transfers the data written to port_b to port_a.
+        LoopbackStreamMock<kCapacity> port_a {b_to_a, a_to_b};  ///< The first endpoint of the pair.
+        LoopbackStreamMock<kCapacity> port_b {a_to_b, b_to_a};  ///< The second endpoint of the pair.
+};
+
+#endif  //AXTLMC_LOOPBACK_STREAM_MOCK_H
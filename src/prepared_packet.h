@@ -0,0 +1,215 @@
+/**
+ * @file
+ *
+ * @brief Provides the PreparedPacket class that stores a fully constructed packet, so that it can be transmitted
+ * multiple times without re-running the COBS encoding and CRC checksum calculation.
+ *
+ * @section pp_description Description:
+ * Many runtimes repeatedly send identical or nearly identical messages, such as heartbeat and status packets. The
+ * PreparedPacket class constructs such a packet once, using the wrapped TransportLayer instance, and stores the
+ * encoded packet in its own buffer. Each subsequent transmission writes the stored packet to the communication
+ * interface with a single write() call. Small payload fields, such as counters and timestamps, can be updated between
+ * transmissions via the Patch() method, which re-encodes only the affected part of the packet.
+ *
+ * @warning If the wrapped TransportLayer instance uses sequence numbers, the packet keeps the sequence number assigned
+ * when it was prepared. Each retransmission of the same prepared packet is therefore reported as a duplicate by the
+ * receiver's sequence tracking.
+ */
+
+#ifndef AXTLMC_PREPARED_PACKET_H
+#define AXTLMC_PREPARED_PACKET_H
+
+#include <Arduino.h>
+#include "axtlmc_shared_assets.h"
+#include "cobs_processor.h"
+
+using namespace axtlmc_shared_assets;
+
+/**
+ * @brief Stores a packet constructed by the wrapped TransportLayer instance and transmits it on demand.
+ *
+ * @tparam TransportType The type of the wrapped TransportLayer instance.
+ */
+template <typename TransportType>
+class PreparedPacket final
+{
+        // Patching the packets in place relies on the checksum being calculated over the encoded packet bytes, which is
+        // not the case for the delimiter-framed layouts.
+        static_assert(
+            !TransportType::Layout::kIsDelimiterFramed,
+            "PreparedPacket does not support delimiter-framed TransportLayer LayoutTypes."
+        );
+
+    public:
+        /**
+         * @brief Initializes the instance's packet buffer.
+         *
+         * @param transport_layer The TransportLayer instance used to construct and transmit the packet.
+         */
+        explicit PreparedPacket(TransportType& transport_layer) : _transport(transport_layer)
+        {}
+
+        /**
+         * @brief Serializes and writes the input object's data to the end of the payload staged for the packet.
+         *
+         * @note The payload is staged in the wrapped TransportLayer's transmission buffer until the Prepare() method is
+         * called.
+         *
+         * @tparam ObjectType The datatype of the object to write to the payload.
+         * @param object The object to write to the payload.
+         * @param object_size The size of the object, in bytes.
+         * @returns true if the object's data was written to the payload, or false if the wrapped TransportLayer's
+         * transmission buffer lacks space for the object.
+         */
+        template <typename ObjectType>
+        bool WriteData(const ObjectType& object, const uint16_t object_size = sizeof(ObjectType))
+        {
+            return _transport.WriteData(object, object_size);
+        }
+
+        /**
+         * @brief Constructs the packet from the payload staged in the wrapped TransportLayer's transmission buffer and
+         * stores it in the instance's packet buffer, replacing any previously prepared packet.
+         *
+         * @note This method resets the wrapped TransportLayer's transmission buffer.
+         *
+         * @returns the size of the prepared packet, in bytes.
+         */
+        uint16_t Prepare()
+        {
+            _packet_size = _transport.EncodeData(_packet);
+            return _packet_size;
+        }
+
+        /**
+         * @brief Transmits the prepared packet over the wrapped TransportLayer's communication interface.
+         *
+         * @returns true if the packet was transmitted, or false if the packet was not prepared.
+         */
+        bool Send()
+        {
+            if (_packet_size == 0) return false;
+            _transport.SendEncodedData(_packet, _packet_size);
+            return true;
+        }
+
+        /**
+         * @brief Overwrites a part of the prepared packet's payload with the input object's data.
+         *
+         * This method re-encodes only the patched part of the packet and incrementally updates the packet's CRC
+         * checksum, so its runtime depends on the size of the patched region rather than the size of the packet.
+         *
+         * @note Locating the patched region requires following the packet's chain of encoded delimiter bytes, so the
+         * runtime also grows with the number of zero bytes that precede the region in the payload.
+         *
+         * @warning This method relies on the linearity of the CRC checksum and requires the wrapped TransportLayer's
+         * checksum engine to provide the ShiftChecksum() method implemented by the CRCProcessor class.
+         *
+         * @tparam ObjectType The datatype of the object to write to the payload.
+         * @param payload_offset The offset of the patched region from the beginning of the payload, in bytes.
+         * @param object The object whose data is written to the patched region.
+         * @param object_size The size of the object, in bytes.
+         * @returns true if the payload was patched, or false if the packet was not prepared or the patched region
+         * extends past the end of the payload.
+         */
+        template <typename ObjectType>
+        bool Patch(
+            const uint16_t payload_offset,
+            const ObjectType& object,
+            const uint16_t object_size = sizeof(ObjectType)
+        )
+        {
+            if (_packet_size == 0) return false;
+
+            // Excludes the sequence number header extension from the patchable payload region.
+            const uint16_t payload_size =
+                _packet[Layout::kPayloadSizeIndex] - TransportType::get_sequence_number_size();
+            if (object_size == 0 || payload_offset + object_size > payload_size) return false;
+
+            const uint16_t start_index =
+                Layout::kPayloadStartIndex + TransportType::get_sequence_number_size() + payload_offset;
+            const uint16_t end_index =
+                Layout::kOverheadByteIndex + _packet[Layout::kPayloadSizeIndex] + 2;
+            const auto& crc_processor = _transport.get_checksum_engine();
+
+            // Patches the packet, capturing the checksums of the original and the patched region, as well as the
+            // original and the patched value of the re-encoded delimiter (or overhead) byte that precedes the region.
+            ChecksumType region_checksum = crc_processor.UpdateChecksum(0, &_packet[start_index], object_size);
+            uint8_t previous_value       = 0;
+            const uint16_t previous_index = COBSProcessor::PatchPayload<Layout>(
+                _packet,
+                start_index,
+                reinterpret_cast<const uint8_t*>(&object),
+                object_size,
+                previous_value
+            );
+            region_checksum ^= crc_processor.UpdateChecksum(0, &_packet[start_index], object_size);
+            previous_value ^= _packet[previous_index];
+
+            // Uses the linearity of the CRC to update the checksum in O(k + log n) time. XORing the original checksum
+            // with the checksums of the byte differences, shifted by the number of bytes that follow each modified
+            // location, yields the checksum of the patched packet. The initial and final XOR values cancel out.
+            ChecksumType checksum = ReadChecksum(end_index);
+            checksum ^= crc_processor.ShiftChecksum(region_checksum, end_index - start_index - object_size);
+            checksum ^= crc_processor.ShiftChecksum(
+                crc_processor.UpdateChecksum(0, &previous_value, 1),
+                end_index - previous_index - 1
+            );
+            WriteChecksum(end_index, checksum);
+            return true;
+        }
+
+        /// Returns a const pointer to the buffer that stores the prepared packet.
+        [[nodiscard]]
+        const uint8_t* get_packet() const
+        {
+            return _packet;
+        }
+
+        /// Returns the size of the prepared packet, in bytes, or 0 if the packet was not prepared.
+        [[nodiscard]]
+        uint16_t get_packet_size() const
+        {
+            return _packet_size;
+        }
+
+    private:
+        /// Stores the datatype of the packet's CRC checksum.
+        using ChecksumType = typename TransportType::ChecksumType;
+
+        /// Stores the PacketLayout of the packet.
+        using Layout = typename TransportType::Layout;
+
+        /// Reads the CRC checksum stored in the packet's postamble, which starts at the input index.
+        [[nodiscard]]
+        ChecksumType ReadChecksum(const uint16_t postamble_index) const
+        {
+            ChecksumType checksum = 0;
+            for (uint16_t i = 0; i < kChecksumSize; ++i) checksum = checksum << 8 | _packet[postamble_index + i];
+            return checksum;
+        }
+
+        /// Writes the input CRC checksum to the packet's postamble, which starts at the input index.
+        void WriteChecksum(const uint16_t postamble_index, const ChecksumType checksum)
+        {
+            for (uint16_t i = 0; i < kChecksumSize; ++i)
+            {
+                _packet[postamble_index + i] = checksum >> 8 * (kChecksumSize - i - 1) & 0xFF;
+            }
+        }
+
+        /// Stores the size of the packet's CRC checksum postamble, in bytes.
+        static constexpr uint8_t kChecksumSize =  // NOLINT(*-dynamic-static-initializers)
+            TransportType::get_postamble_size();
+
+        /// The reference to the TransportLayer instance that constructs and transmits the packet.
+        TransportType& _transport;
+
+        /// Stores the prepared packet.
+        uint8_t _packet[TransportType::get_transmission_buffer_size()] {};
+
+        /// Stores the size of the prepared packet, in bytes.
+        uint16_t _packet_size = 0;
+};
+
+#endif  //AXTLMC_PREPARED_PACKET_H
@@ -0,0 +1,304 @@
+/**
+ * @file
+ *
+ * @brief Provides the ReceptionQueue class that buffers the payloads of multiple received packets, so that packet
+ * bursts are not lost between the application's loop iterations.
+ *
+ * @section rq_description Description:
+ * The TransportLayer class stores exactly one decoded payload, which is discarded as soon as the next packet is
+ * received. The ReceptionQueue class wraps a TransportLayer instance and copies each decoded payload into a fixed-size
+ * queue, from which the application can consume the payloads in the order they were received at its own pace. All
+ * queue storage is allocated statically, based on the class template parameters.
+ *
+ * The queue is filled by a non-blocking poll: the received bytes are read from the communication interface in bulk and
+ * framed by a StreamingReceiver instance, so the partially received packets are kept until their remaining bytes
+ * arrive instead of being awaited.
+ *
+ * @warning Each queue slot reserves the maximum received payload size of the wrapped TransportLayer instance plus one
+ * byte of RAM, and the framing buffer reserves the wrapped TransportLayer instance's reception buffer size of RAM. On
+ * boards with limited RAM, such as Arduino Mega, reduce the queue capacity or the TransportLayer's
+ * kMaximumReceivedPayloadSize template parameter accordingly.
+ */
+
+#ifndef AXTLMC_RECEPTION_QUEUE_H
+#define AXTLMC_RECEPTION_QUEUE_H
+
+#include <Arduino.h>
+#include "axtlmc_shared_assets.h"
+#include "streaming_receiver.h"
+
+using namespace axtlmc_shared_assets;
+
+/**
+ * @brief Buffers the payloads of the packets received by the wrapped TransportLayer instance in a fixed-capacity
+ * first-in, first-out queue.
+ *
+ * @tparam TransportType The type of the wrapped TransportLayer instance.
+ * @tparam kCapacity The maximum number of payloads that can be stored in the queue. Must be a value between 1 and 255.
+ * @tparam kOverflowPolicy The policy used to resolve queue overflows. Defaults to discarding the oldest queued payload.
+ */
+template <
+    typename TransportType,
+    const uint8_t kCapacity                      = 4,
+    const kQueueOverflowPolicies kOverflowPolicy = kQueueOverflowPolicies::kDropOldest>
+class ReceptionQueue final
+{
+        static_assert(kCapacity > 0, "ReceptionQueue's kCapacity template parameter must be greater than zero.");
+
+    public:
+        /**
+         * @brief Initializes the instance's queue trackers.
+         *
+         * @param transport_layer The TransportLayer instance used to receive the queued packets. The queue must be the
+         * only user of this TransportLayer instance's reception methods.
+         */
+        explicit ReceptionQueue(TransportType& transport_layer) :
+            _transport(transport_layer),
+            _receiver(transport_layer)
+        {}
+
+        /**
+         * @brief Reads the bytes received by the communication interface and adds the payloads of all packets
+         * completed by these bytes to the queue.
+         *
+         * If the queue is full, the overflow is resolved using the policy specified by the kOverflowPolicy template
+         * parameter, and the dropped payloads are added to the overflow counter.
+         *
+         * @note This method never blocks. It only reads the bytes that are available when it is called, so a steady
+         * sender cannot keep the caller inside this method. The bytes of the partially received packets are kept
+         * until the next call.
+         *
+         * @returns the number of received packets that were added to the queue.
+         */
+        uint8_t Poll()
+        {
+            uint8_t queued_packets = 0;
+            bool overflow          = false;
+
+            // Caps the number of read bytes at the number of bytes received before the call.
+            Stream& port              = _transport.get_port();
+            const int available_bytes = port.available();
+            uint32_t remaining_bytes  = available_bytes > 0 ? static_cast<uint32_t>(available_bytes) : 0;
+            while (true)
+            {
+                // Queues all packets framed from the accumulated bytes. Each ReceiveData() call that does not report
+                // the kNoPacketsFramed status discards at least one accumulated byte, so the loop is guaranteed to
+                // terminate and to leave free space in the framing buffer.
+                while (true)
+                {
+                    if (!_receiver.ReceiveData())
+                    {
+                        if (_receiver.get_runtime_status() ==
+                            static_cast<uint8_t>(kStreamingReceiverStatusCodes::kNoPacketsFramed))
+                        {
+                            break;
+                        }
+                        continue;
+                    }
+
+                    // Resolves the overflow before storing the payload.
+                    if (_size == kCapacity)
+                    {
+                        overflow = true;
+                        _overflow_count++;
+                        if (kOverflowPolicy == kQueueOverflowPolicies::kDropNewest) continue;
+
+                        _head = (_head + 1) % kCapacity;
+                        _size--;
+                    }
+
+                    // Copies the received payload into the next free queue slot.
+                    QueueSlot& slot   = _slots[(_head + _size) % kCapacity];
+                    slot.payload_size = _transport.get_bytes_in_reception_buffer();
+                    _transport.ReadData(slot.payload, slot.payload_size);
+                    _size++;
+                    queued_packets++;
+                    if (_size > _peak_size) _peak_size = _size;
+                }
+
+                if (remaining_bytes == 0) break;
+
+                // Reads the next chunk of the received bytes directly into the framing buffer.
+                const auto chunk_size =
+                    static_cast<uint16_t>(min(remaining_bytes, static_cast<uint32_t>(_receiver.get_free_space())));
+                const auto bytes_read =
+                    static_cast<uint16_t>(port.readBytes(_receiver.get_write_buffer(), chunk_size));
+                if (bytes_read == 0) break;
+                _receiver.CommitWrite(bytes_read);
+                remaining_bytes -= bytes_read;
+            }
+
+            if (overflow)
+            {
+                _runtime_status = static_cast<uint8_t>(kReceptionQueueStatusCodes::kQueueOverflow);
+            }
+            else if (queued_packets > 0)
+            {
+                _runtime_status = static_cast<uint8_t>(kReceptionQueueStatusCodes::kPacketsQueued);
+            }
+            else
+            {
+                _runtime_status = static_cast<uint8_t>(kReceptionQueueStatusCodes::kNoPacketsQueued);
+            }
+            return queued_packets;
+        }
+
+        /**
+         * @brief Overwrites the input object's data with the data from the beginning of the oldest queued payload,
+         * without removing the payload from the queue.
+         *
+         * @tparam ObjectType The datatype of the object to read from the payload.
+         * @param object The object to read from the payload.
+         * @param object_size The size of the object, in bytes.
+         * @returns true if the object's data was read from the payload, or false if the queue is empty or the oldest
+         * queued payload is smaller than object_size.
+         */
+        template <typename ObjectType>
+        bool Peek(ObjectType& object, const uint16_t object_size = sizeof(ObjectType))
+        {
+            if (_size == 0)
+            {
+                _runtime_status = static_cast<uint8_t>(kReceptionQueueStatusCodes::kQueueEmpty);
+                return false;
+            }
+
+            const QueueSlot& slot = _slots[_head];
+            if (object_size > slot.payload_size)
+            {
+                _runtime_status = static_cast<uint8_t>(kReceptionQueueStatusCodes::kReadObjectQueueError);
+                return false;
+            }
+
+            memcpy(static_cast<void*>(&object), static_cast<const void*>(slot.payload), object_size);
+            _runtime_status = static_cast<uint8_t>(kReceptionQueueStatusCodes::kPacketPeeked);
+            return true;
+        }
+
+        /**
+         * @brief Overwrites the input object's data with the data from the beginning of the oldest queued payload and
+         * removes the payload from the queue.
+         *
+         * @note If the object cannot be read from the payload, the payload is kept in the queue.
+         *
+         * @tparam ObjectType The datatype of the object to read from the payload.
+         * @param object The object to read from the payload.
+         * @param object_size The size of the object, in bytes.
+         * @returns true if the object's data was read from the payload, or false if the queue is empty or the oldest
+         * queued payload is smaller than object_size.
+         */
+        template <typename ObjectType>
+        bool Pop(ObjectType& object, const uint16_t object_size = sizeof(ObjectType))
+        {
+            if (!Peek(object, object_size)) return false;
+            return Pop();
+        }
+
+        /**
+         * @brief Removes the oldest queued payload from the queue without reading its data.
+         *
+         * @returns true if the payload was removed, or false if the queue is empty.
+         */
+        bool Pop()
+        {
+            if (_size == 0)
+            {
+                _runtime_status = static_cast<uint8_t>(kReceptionQueueStatusCodes::kQueueEmpty);
+                return false;
+            }
+
+            _head = (_head + 1) % kCapacity;
+            _size--;
+            _runtime_status = static_cast<uint8_t>(kReceptionQueueStatusCodes::kPacketPopped);
+            return true;
+        }
+
+        /// Removes all payloads from the queue.
+        void Clear()
+        {
+            _head = 0;
+            _size = 0;
+        }
+
+        /// Returns the size of the oldest queued payload, in bytes, or 0 if the queue is empty.
+        [[nodiscard]]
+        uint8_t get_front_payload_size() const
+        {
+            return _size == 0 ? 0 : _slots[_head].payload_size;
+        }
+
+        /// Returns the number of payloads currently stored in the queue.
+        [[nodiscard]]
+        uint8_t get_size() const
+        {
+            return _size;
+        }
+
+        /// Returns the maximum number of payloads that can be stored in the queue.
+        [[nodiscard]]
+        static constexpr uint8_t get_capacity()
+        {
+            return kCapacity;
+        }
+
+        /// Returns the largest number of payloads simultaneously stored in the queue since the counters were reset.
+        [[nodiscard]]
+        uint8_t get_peak_size() const
+        {
+            return _peak_size;
+        }
+
+        /// Returns the number of received payloads dropped due to queue overflows since the counters were reset.
+        [[nodiscard]]
+        uint32_t get_overflow_count() const
+        {
+            return _overflow_count;
+        }
+
+        /// Resets the overflow counter and the peak queue size tracker.
+        void ResetCounters()
+        {
+            _overflow_count = 0;
+            _peak_size      = _size;
+        }
+
+        /// Returns the runtime status of the most recently called method.
+        [[nodiscard]]
+        uint8_t get_runtime_status() const
+        {
+            return _runtime_status;
+        }
+
+    private:
+        /// Stores a single queued payload.
+        struct QueueSlot
+        {
+                uint8_t payload[TransportType::get_maximum_received_payload_size()];  ///< The payload data.
+                uint8_t payload_size = 0;  ///< The size of the payload, in bytes.
+        };
+
+        /// The reference to the TransportLayer instance that receives the queued packets.
+        TransportType& _transport;
+
+        /// Frames the received bytes into packets and passes them to the wrapped TransportLayer instance.
+        StreamingReceiver<TransportType, TransportType::get_reception_buffer_size()> _receiver;
+
+        /// Stores the queued payloads.
+        QueueSlot _slots[kCapacity];
+
+        /// Stores the index of the slot that holds the oldest queued payload.
+        uint8_t _head = 0;
+
+        /// Stores the number of queued payloads.
+        uint8_t _size = 0;
+
+        /// Tracks the largest number of simultaneously queued payloads.
+        uint8_t _peak_size = 0;
+
+        /// Tracks the number of payloads dropped due to queue overflows.
+        uint32_t _overflow_count = 0;
+
+        /// Stores the runtime status of the most recently called method.
+        uint8_t _runtime_status = static_cast<uint8_t>(kReceptionQueueStatusCodes::kStandby);
+};
+
+#endif  //AXTLMC_RECEPTION_QUEUE_H
@@ -0,0 +1,403 @@
+/**
+ * @file
+ *
+ * @brief Provides the ReliableChannel class that adds acknowledged delivery with selective retransmission on top of
+ * the TransportLayer class.
+ *
+ * @section rc_description Description:
+ * The ReliableChannel class wraps a TransportLayer instance and guarantees that each packet sent through the channel
+ * is eventually received by the peer channel exactly once, as long as the communication link is not permanently
+ * interrupted. Each transmitted packet is encoded once and stored in a fixed-size retransmission window until the peer
+ * acknowledges it. Unacknowledged packets are retransmitted from the window, without re-running the COBS encoding
+ * and CRC checksum calculation, once their acknowledgement timeout expires.
+ *
+ * @section rc_packet_anatomy Payload Anatomy:
+ * The channel prepends a 2-byte header to the payload of each TransportLayer packet it sends:
+ * [PACKET TYPE] [SEQUENCE NUMBER] [PAYLOAD]
+ *
+ * Acknowledgement packets use the following payload layout:
+ * [PACKET TYPE] [NEXT EXPECTED SEQUENCE NUMBER] [SELECTIVE ACKNOWLEDGEMENT BITMAP]
+ *
+ * The next expected sequence number cumulatively acknowledges all preceding packets. Each set bit 'i' of the 16-bit
+ * selective acknowledgement bitmap acknowledges the packet whose sequence number follows the next expected sequence
+ * number by i + 1.
+ *
+ * @note New packets are delivered to the application as soon as they are received, which may not match the order in
+ * which they were sent if some packets are lost and retransmitted. Duplicated packets are always discarded.
+ *
+ * @warning Both communicating channels must be started (or restarted) together, as the channel does not
+ * resynchronize the sequence numbers at runtime.
+ */
+
+#ifndef AXTLMC_RELIABLE_CHANNEL_H
+#define AXTLMC_RELIABLE_CHANNEL_H
+
+#include <Arduino.h>
+#include <elapsedMillis.h>
+#include "axtlmc_shared_assets.h"
+
+using namespace axtlmc_shared_assets;
+
+/**
+ * @brief Provides acknowledged, duplicate-free packet delivery over the wrapped TransportLayer instance.
+ *
+ * @tparam TransportType The type of the wrapped TransportLayer instance.
+ * @tparam kWindowSize The maximum number of unacknowledged packets that can be in flight at the same time. This
+ * parameter controls the number of pre-encoded packets stored by the instance. Must be a value between 1 and 16.
+ */
+template <typename TransportType, const uint8_t kWindowSize = 4>
+class ReliableChannel final
+{
+        // Ensures that the selective acknowledgement bitmap can track every packet in the retransmission window.
+        static_assert(
+            kWindowSize > 0 && kWindowSize <= 16,
+            "ReliableChannel's kWindowSize template parameter must be a value between 1 and 16."
+        );
+
+        // Ensures that the wrapped TransportLayer instance can transmit the acknowledgement packets.
+        static_assert(
+            TransportType::get_maximum_transmitted_payload_size() >= 4,
+            "ReliableChannel requires the wrapped TransportLayer's kMaximumTransmittedPayloadSize template parameter "
+            "to be at least 4."
+        );
+
+    public:
+        /**
+         * @brief Initializes the instance's retransmission window and acknowledgement trackers.
+         *
+         * @param transport_layer The TransportLayer instance used to send and receive the channel's packets. The
+         * channel must be the only user of this TransportLayer instance.
+         * @param retransmission_timeout The number of milliseconds to wait for the packet's acknowledgement before
+         * retransmitting the packet. Defaults to 20 ms.
+         */
+        explicit ReliableChannel(TransportType& transport_layer, const uint16_t retransmission_timeout = 20) :
+            _transport(transport_layer), _retransmission_timeout(retransmission_timeout)
+        {}
+
+        /**
+         * @brief Serializes and writes the input object's data to the end of the payload of the next reliable packet.
+         *
+         * @note The first call after each sent packet also writes the reliable channel header into the payload.
+         *
+         * @tparam ObjectType The datatype of the object to write to the payload.
+         * @param object The object to write to the payload.
+         * @param object_size The size of the object, in bytes.
+         * @returns true if the object's data was written to the payload, or false if the wrapped TransportLayer's
+         * transmission buffer lacks space for the object.
+         */
+        template <typename ObjectType>
+        bool WriteData(const ObjectType& object, const uint16_t object_size = sizeof(ObjectType))
+        {
+            if (!WriteHeader()) return false;
+            return _transport.WriteData(object, object_size);
+        }
+
+        /**
+         * @brief Overwrites the input object's data with the data from the payload of the most recently received
+         * reliable packet, consuming (discarding) all read bytes.
+         *
+         * @tparam ObjectType The datatype of the object to read from the payload.
+         * @param object The object to read from the payload.
+         * @param object_size The size of the object, in bytes.
+         * @returns true if the object's data was read from the payload, or false if fewer than object_size unread
+         * payload bytes remain.
+         */
+        template <typename ObjectType>
+        bool ReadData(ObjectType& object, const uint16_t object_size = sizeof(ObjectType))
+        {
+            return _transport.ReadData(object, object_size);
+        }
+
+        /**
+         * @brief Encodes the staged payload into a reliable packet, stores it in the retransmission window, and
+         * transmits it to the peer channel.
+         *
+         * @note If the retransmission window is full, the staged payload is kept, so the call can be repeated after
+         * the peer acknowledges some of the in-flight packets.
+         *
+         * @returns true if the packet was transmitted, or false if the retransmission window is full.
+         */
+        bool SendData()
+        {
+            if (_packets_in_flight == kWindowSize)
+            {
+                _runtime_status = static_cast<uint8_t>(kReliableChannelStatusCodes::kRetransmissionWindowFull);
+                return false;
+            }
+
+            // Ensures that empty payloads also carry the reliable channel header.
+            WriteHeader();
+
+            // Encodes the packet directly into the next free retransmission window slot and transmits it from there.
+            WindowSlot& slot   = _window[(_window_start + _packets_in_flight) % kWindowSize];
+            slot.packet_size   = _transport.EncodeData(slot.packet);
+            slot.acknowledged  = false;
+            slot.timeout_timer = 0;
+            _transport.SendEncodedData(slot.packet, slot.packet_size);
+
+            _next_sequence_number++;
+            _packets_in_flight++;
+            _runtime_status = static_cast<uint8_t>(kReliableChannelStatusCodes::kPacketSent);
+            return true;
+        }
+
+        /**
+         * @brief Receives and processes the next packet sent by the peer channel.
+         *
+         * Acknowledgement packets are used to release the acknowledged packets from the retransmission window.
+         * Reliable packets are acknowledged and, unless they were already received, made available for reading via
+         * the ReadData() method.
+         *
+         * @returns true if a new reliable packet was received and false otherwise. Use get_runtime_status() to
+         * determine the type of the processed packet.
+         */
+        bool ReceiveData()
+        {
+            if (!_transport.ReceiveData())
+            {
+                _runtime_status = static_cast<uint8_t>(kReliableChannelStatusCodes::kNoPacketReceived);
+                return false;
+            }
+
+            uint8_t header[kHeaderSize];
+            if (!_transport.ReadData(header))
+            {
+                _runtime_status = static_cast<uint8_t>(kReliableChannelStatusCodes::kUnexpectedPacketReceived);
+                return false;
+            }
+
+            if (header[0] == kAcknowledgementPacket)
+            {
+                uint16_t bitmap = 0;
+                _transport.ReadData(bitmap);
+                ProcessAcknowledgement(header[1], bitmap);
+                _runtime_status = static_cast<uint8_t>(kReliableChannelStatusCodes::kAcknowledgementReceived);
+                return false;
+            }
+
+            if (header[0] != kReliablePacket)
+            {
+                _runtime_status = static_cast<uint8_t>(kReliableChannelStatusCodes::kUnexpectedPacketReceived);
+                return false;
+            }
+
+            // Computes the wrapped distance from the next expected sequence number to the received sequence number.
+            const uint8_t offset = header[1] - _next_expected_sequence_number;
+
+            // Discards the packets that precede the next expected sequence number or that were already received out
+            // of order. Since the acknowledgement for these packets was likely lost, re-acknowledges them.
+            if (offset >= kOldPacketOffset ||
+                (offset > 0 && offset <= kWindowSize && _received_window >> (offset - 1) & 1))
+            {
+                SendAcknowledgement();
+                _runtime_status = static_cast<uint8_t>(kReliableChannelStatusCodes::kDuplicatePacketReceived);
+                return false;
+            }
+
+            // Discards the packets that are too far ahead to be tracked by the acknowledgement bitmap.
+            if (offset > kWindowSize)
+            {
+                _runtime_status = static_cast<uint8_t>(kReliableChannelStatusCodes::kUnexpectedPacketReceived);
+                return false;
+            }
+
+            if (offset == 0)
+            {
+                // Advances the next expected sequence number past the received packet and any packets that were
+                // previously received out of order.
+                _next_expected_sequence_number++;
+                while (_received_window & 1)
+                {
+                    _received_window >>= 1;
+                    _next_expected_sequence_number++;
+                }
+                _received_window >>= 1;
+            }
+            else
+            {
+                _received_window |= static_cast<uint16_t>(1) << (offset - 1);
+            }
+
+            SendAcknowledgement();
+            _runtime_status = static_cast<uint8_t>(kReliableChannelStatusCodes::kPacketReceived);
+            return true;
+        }
+
+        /**
+         * @brief Retransmits all in-flight packets whose acknowledgement timeout has expired and sends the deferred
+         * acknowledgement, if any.
+         *
+         * @note This method should be called cyclically (as part of a loop) while the channel is in use.
+         */
+        void Poll()
+        {
+            if (_acknowledgement_pending) SendAcknowledgement();
+
+            for (uint8_t i = 0; i < _packets_in_flight; ++i)
+            {
+                WindowSlot& slot = _window[(_window_start + i) % kWindowSize];
+                if (!slot.acknowledged && slot.timeout_timer >= _retransmission_timeout)
+                {
+                    _transport.SendEncodedData(slot.packet, slot.packet_size);
+                    slot.timeout_timer = 0;
+                    _retransmitted_packets++;
+                }
+            }
+        }
+
+        /// Returns the number of transmitted packets that are waiting to be acknowledged by the peer channel.
+        [[nodiscard]]
+        uint8_t get_packets_in_flight() const
+        {
+            return _packets_in_flight;
+        }
+
+        /// Returns the total number of packet retransmissions carried out by the instance.
+        [[nodiscard]]
+        uint32_t get_retransmitted_packets() const
+        {
+            return _retransmitted_packets;
+        }
+
+        /// Returns the maximum number of unacknowledged packets that can be in flight at the same time.
+        [[nodiscard]]
+        static constexpr uint8_t get_window_size()
+        {
+            return kWindowSize;
+        }
+
+        /// Returns the runtime status of the most recently called method.
+        [[nodiscard]]
+        uint8_t get_runtime_status() const
+        {
+            return _runtime_status;
+        }
+
+    private:
+        /// Stores the size of the reliable channel header, in bytes.
+        static constexpr uint8_t kHeaderSize = 2;
+
+        /// Stores the packet type code used by reliable packets.
+        static constexpr uint8_t kReliablePacket = 1;
+
+        /// Stores the packet type code used by acknowledgement packets.
+        static constexpr uint8_t kAcknowledgementPacket = 2;
+
+        /// Stores the smallest wrapped sequence number offset interpreted as a packet that precedes the next expected
+        /// sequence number.
+        static constexpr uint8_t kOldPacketOffset = 128;
+
+        /// Stores a transmitted packet together with its acknowledgement tracking data.
+        struct WindowSlot
+        {
+                uint8_t packet[TransportType::get_transmission_buffer_size()];  ///< The pre-encoded packet.
+                uint16_t packet_size = 0;                                        ///< The size of the packet, in bytes.
+                bool acknowledged    = false;  ///< Determines whether the peer acknowledged the packet.
+                elapsedMillis timeout_timer;   ///< Tracks the time since the packet was last transmitted.
+        };
+
+        /// The reference to the TransportLayer instance that sends and receives the channel's packets.
+        TransportType& _transport;
+
+        /// Stores the number of milliseconds to wait for an acknowledgement before retransmitting the packet.
+        const uint16_t _retransmission_timeout;
+
+        /// Stores the pre-encoded packets that were transmitted but not yet acknowledged.
+        WindowSlot _window[kWindowSize];
+
+        /// Stores the index of the window slot that holds the oldest in-flight packet.
+        uint8_t _window_start = 0;
+
+        /// Stores the number of in-flight packets.
+        uint8_t _packets_in_flight = 0;
+
+        /// Stores the sequence number of the oldest in-flight packet.
+        uint8_t _oldest_sequence_number = 0;
+
+        /// Stores the sequence number assigned to the next transmitted packet.
+        uint8_t _next_sequence_number = 0;
+
+        /// Stores the sequence number of the next reliable packet expected from the peer channel.
+        uint8_t _next_expected_sequence_number = 0;
+
+        /// Tracks the out-of-order packets received from the peer channel. Bit 'i' corresponds to the sequence number
+        /// that follows the next expected sequence number by i + 1.
+        uint16_t _received_window = 0;
+
+        /// Determines whether the acknowledgement was deferred because the transmission buffer was in use.
+        bool _acknowledgement_pending = false;
+
+        /// Tracks the total number of packet retransmissions.
+        uint32_t _retransmitted_packets = 0;
+
+        /// Stores the runtime status of the most recently called method.
+        uint8_t _runtime_status = static_cast<uint8_t>(kReliableChannelStatusCodes::kStandby);
+
+        /**
+         * @brief Writes the reliable channel header to the wrapped TransportLayer's transmission buffer if it does not
+         * yet store any payload data.
+         *
+         * @returns true if the header is stored in the transmission buffer and false otherwise.
+         */
+        bool WriteHeader()
+        {
+            if (_transport.get_bytes_in_transmission_buffer() != 0) return true;
+            const uint8_t header[kHeaderSize] = {kReliablePacket, _next_sequence_number};
+            return _transport.WriteData(header);
+        }
+
+        /**
+         * @brief Sends the acknowledgement packet that reports the current reception state to the peer channel.
+         *
+         * If the wrapped TransportLayer's transmission buffer stages the payload of another packet, defers the
+         * acknowledgement until the next Poll() call.
+         */
+        void SendAcknowledgement()
+        {
+            if (_transport.get_bytes_in_transmission_buffer() != 0)
+            {
+                _acknowledgement_pending = true;
+                return;
+            }
+
+            const uint8_t header[kHeaderSize] = {kAcknowledgementPacket, _next_expected_sequence_number};
+            _transport.WriteData(header);
+            _transport.WriteData(_received_window);
+            _transport.SendData();
+            _acknowledgement_pending = false;
+        }
+
+        /**
+         * @brief Marks the in-flight packets acknowledged by the peer channel and releases the acknowledged packets
+         * at the start of the retransmission window.
+         *
+         * @param next_expected_sequence_number The sequence number of the next packet expected by the peer channel.
+         * @param bitmap The selective acknowledgement bitmap received from the peer channel.
+         */
+        void ProcessAcknowledgement(const uint8_t next_expected_sequence_number, const uint16_t bitmap)
+        {
+            for (uint8_t i = 0; i < _packets_in_flight; ++i)
+            {
+                const uint8_t sequence_number = _oldest_sequence_number + i;
+                const uint8_t offset          = sequence_number - next_expected_sequence_number;
+
+                // Packets that precede the next expected sequence number are acknowledged cumulatively. Packets that
+                // follow it are acknowledged by the bitmap.
+                if (offset >= kOldPacketOffset || (offset > 0 && offset <= 16 && bitmap >> (offset - 1) & 1))
+                {
+                    _window[(_window_start + i) % kWindowSize].acknowledged = true;
+                }
+            }
+
+            // Releases the acknowledged packets from the start of the window, which makes their slots available to
+            // the new packets.
+            while (_packets_in_flight > 0 && _window[_window_start].acknowledged)
+            {
+                _window_start = (_window_start + 1) % kWindowSize;
+                _oldest_sequence_number++;
+                _packets_in_flight--;
+            }
+        }
+};
+
+#endif  //AXTLMC_RELIABLE_CHANNEL_H
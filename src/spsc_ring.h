@@ -0,0 +1,155 @@
+/**
+ * @file
+ *
+ * @brief Provides the SpscRing class that transfers elements from a single producer to a single consumer without
+ * locks or disabling interrupts.
+ *
+ * @section spsc_description Description:
+ * The producer (usually an interrupt service routine or the serialEvent() callback) and the consumer (usually the
+ * application's loop) each own one of the ring's two indices. Each side only writes its own index and reads the other
+ * side's index, so the ring does not need locks. The indices are single bytes that wrap around naturally, which makes
+ * every index access atomic on all supported boards, including the 8-bit AVR boards.
+ *
+ * The elements can be copied into and out of the ring, or written and read in place through the slot pointers
+ * returned by the get_write_slot() and get_read_slot() methods. In-place access avoids copying large elements, such as
+ * packet buffers, inside the interrupt service routines.
+ */
+
+#ifndef AXTLMC_SPSC_RING_H
+#define AXTLMC_SPSC_RING_H
+
+#include <Arduino.h>
+#include "axtlmc_shared_assets.h"
+
+using namespace axtlmc_shared_assets;
+
+/**
+ * @brief Stores the elements passed from a single producer to a single consumer in a fixed-capacity lock-free
+ * first-in, first-out ring.
+ *
+ * @warning The Push(), get_write_slot(), and CommitWrite() methods must only be called by the producer, and the Pop(),
+ * get_read_slot(), and CommitRead() methods must only be called by the consumer. Using multiple producers or multiple
+ * consumers corrupts the ring.
+ *
+ * @tparam ElementType The datatype of the stored elements.
+ * @tparam kCapacity The maximum number of elements that can be stored in the ring. Must be a power of two between 1
+ * and 128.
+ */
+template <typename ElementType, const uint8_t kCapacity>
+class SpscRing final
+{
+        static_assert(
+            kCapacity > 0 && kCapacity <= 128 && (kCapacity & (kCapacity - 1)) == 0,
+            "SpscRing's kCapacity template parameter must be a power of two between 1 and 128."
+        );
+
+    public:
+        /// Initializes the ring's indices.
+        SpscRing() = default;
+
+        /**
+         * @brief Copies the input element to the end of the ring.
+         *
+         * @param element The element to add to the ring.
+         * @returns true if the element was added to the ring, or false if the ring is full.
+         */
+        bool Push(const ElementType& element)
+        {
+            ElementType* slot = get_write_slot();
+            if (slot == nullptr) return false;
+
+            *slot = element;
+            CommitWrite();
+            return true;
+        }
+
+        /**
+         * @brief Copies the oldest element stored in the ring into the input element and removes it from the ring.
+         *
+         * @param element The element to overwrite with the oldest element stored in the ring.
+         * @returns true if the element was read from the ring, or false if the ring is empty.
+         */
+        bool Pop(ElementType& element)
+        {
+            const ElementType* slot = get_read_slot();
+            if (slot == nullptr) return false;
+
+            element = *slot;
+            CommitRead();
+            return true;
+        }
+
+        /**
+         * @brief Returns the pointer to the free slot that stores the next element added to the ring.
+         *
+         * The element written to the slot becomes visible to the consumer after the CommitWrite() method is called.
+         * Until then, repeated calls return the same slot.
+         *
+         * @returns the pointer to the free slot, or nullptr if the ring is full.
+         */
+        ElementType* get_write_slot()
+        {
+            const uint8_t tail = LoadAcquire(_tail);
+            if (static_cast<uint8_t>(_head - tail) == kCapacity) return nullptr;
+            return &_slots[_head & kIndexMask];
+        }
+
+        /// Publishes the element written to the slot returned by the get_write_slot() method to the consumer. Must only
+        /// be called after get_write_slot() returns a valid slot.
+        void CommitWrite()
+        {
+            StoreRelease(_head, static_cast<uint8_t>(_head + 1));
+        }
+
+        /**
+         * @brief Returns the pointer to the slot that stores the oldest element in the ring.
+         *
+         * The slot is released back to the producer after the CommitRead() method is called. Until then, repeated
+         * calls return the same slot.
+         *
+         * @returns the pointer to the oldest element, or nullptr if the ring is empty.
+         */
+        ElementType* get_read_slot()
+        {
+            const uint8_t head = LoadAcquire(_head);
+            if (head == _tail) return nullptr;
+            return &_slots[_tail & kIndexMask];
+        }
+
+        /// Releases the slot returned by the get_read_slot() method back to the producer. Must only be called after
+        /// get_read_slot() returns a valid slot.
+        void CommitRead()
+        {
+            StoreRelease(_tail, static_cast<uint8_t>(_tail + 1));
+        }
+
+        /// Returns the number of elements stored in the ring. If called while the other side modifies the ring, the
+        /// returned value may already be outdated.
+        [[nodiscard]]
+        uint8_t get_size() const
+        {
+            return static_cast<uint8_t>(LoadAcquire(_head) - LoadAcquire(_tail));
+        }
+
+        /// Returns the maximum number of elements that can be stored in the ring.
+        [[nodiscard]]
+        static constexpr uint8_t get_capacity()
+        {
+            return kCapacity;
+        }
+
+    private:
+        /// Maps the free-running indices to the slot indices.
+        static constexpr uint8_t kIndexMask = kCapacity - 1;
+
+        /// Stores the ring's elements.
+        ElementType _slots[kCapacity] {};
+
+        /// Stores the free-running index of the next slot to write. Only modified by the producer.
+        uint8_t _head = 0;
+
+        /// Stores the free-running index of the next slot to read. Only modified by the consumer.
+        uint8_t _tail = 0;
+};
+
+#endif  //AXTLMC_SPSC_RING_H
@@ -1,8 +1,12 @@
 /**
  * @file
  *
- * @brief Provides the StreamMock class used to simulate a Serial Stream interface for testing the TransportLayer
- * class.
+ * @brief Provides the StreamMock and CompactStreamMock classes used to simulate a Serial Stream interface for testing
+ * the TransportLayer class.
+ *
+ * @note StreamMock exposes its buffers for direct manipulation and is intended for precise, small-scale tests.
+ * CompactStreamMock stores the data in byte-sized ring buffers and performs all Stream operations in constant time,
+ * which makes it better suited for large-volume stress and benchmark tests.
  */
 
 #ifndef AXTLMC_STREAM_MOCK_H
@@ -218,4 +222,237 @@ class StreamMock final : public Stream
         virtual ~StreamMock() = default;
 };
 
+/**
+ * @brief Simulates a Serial Stream interface using byte-sized reception and transmission ring buffers.
+ *
+ * Unlike StreamMock, this class stores each byte in a single uint8_t element and tracks the readable region of the
+ * reception buffer with explicit head and size indices, so available(), read(), and peek() run in constant time
+ * regardless of the amount of buffered data. To simulate transmission stalls, individual reception buffer bytes can be
+ * marked as invalid using a validity bitmap. Similar to the -1 values used by StreamMock, an invalid byte and all
+ * bytes that follow it cannot be read until the byte is marked as valid again.
+ *
+ * @tparam kBufferSize the size, in bytes, to use for the transmission and reception buffers.
+ */
+template <const uint16_t kBufferSize = 1024>
+class CompactStreamMock final : public Stream
+{
+        static_assert(kBufferSize > 0, "CompactStreamMock buffer size must be greater than zero.");
+
+    public:
+        /// Stores the size of the instance's reception and transmission buffers, in bytes.
+        static constexpr uint16_t kStreamBufferSize = kBufferSize;  // NOLINT(*-dynamic-static-initializers)
+
+        /// Initializes the instance with empty transmission and reception buffers.
+        CompactStreamMock() = default;
+
+        /**
+         * @brief Appends the input bytes to the end of the reception buffer, making them available for reading.
+         *
+         * @param buffer the buffer that stores the bytes to append.
+         * @param length the number of bytes to append.
+         * @returns the number of appended bytes, which is less than length if the reception buffer becomes full.
+         */
+        size_t PushReceptionData(const uint8_t* buffer, const size_t length)
+        {
+            const size_t bytes_to_push = min(length, static_cast<size_t>(kBufferSize - _rx_size));
+            const uint16_t tail        = (_rx_head + _rx_size) % kBufferSize;
+
+            // Copies the data in up to two contiguous chunks and marks the overwritten bytes as valid.
+            const size_t first_chunk = min(bytes_to_push, static_cast<size_t>(kBufferSize - tail));
+            memcpy(&_rx_buffer[tail], buffer, first_chunk);
+            memcpy(_rx_buffer, buffer + first_chunk, bytes_to_push - first_chunk);
+            for (size_t i = 0; i < bytes_to_push; ++i) SetInvalid((tail + i) % kBufferSize, false);
+
+            // The new bytes are readable unless an invalid byte precedes them.
+            if (_rx_readable == _rx_size) _rx_readable += bytes_to_push;
+            _rx_size += bytes_to_push;
+            return bytes_to_push;
+        }
+
+        /**
+         * @brief Marks the reception buffer byte at the specified offset from the current read position as invalid or
+         * valid.
+         *
+         * @param offset the offset of the target byte from the current read position. Must be less than the number of
+         * bytes stored in the reception buffer.
+         * @param invalid determines whether to mark the byte as invalid (true) or valid (false).
+         */
+        void SetReceptionByteInvalid(const size_t offset, const bool invalid = true)
+        {
+            if (offset >= _rx_size) return;
+            SetInvalid((_rx_head + offset) % kBufferSize, invalid);
+
+            // Finds the first invalid byte to determine the new size of the readable region. This only runs when the
+            // validity bitmap is modified, so the reading methods stay constant-time.
+            _rx_readable = 0;
+            while (_rx_readable < _rx_size && !IsInvalid((_rx_head + _rx_readable) % kBufferSize)) _rx_readable++;
+        }
+
+        /**
+         * @brief Moves all data written to the instance's transmission buffer into the destination instance's
+         * reception buffer, simulating two Stream interfaces wired back-to-back.
+         *
+         * @param destination the instance that receives the transmitted data.
+         * @returns the number of moved bytes. Bytes that do not fit into the destination's reception buffer are
+         * discarded.
+         */
+        template <const uint16_t kDestinationSize>
+        size_t MoveTransmittedData(CompactStreamMock<kDestinationSize>& destination)
+        {
+            const size_t moved = destination.PushReceptionData(_tx_buffer, _tx_size);
+            _tx_size           = 0;
+            return moved;
+        }
+
+        /// Returns the buffer that stores the data written to the instance.
+        [[nodiscard]]
+        const uint8_t* get_transmitted_data() const
+        {
+            return _tx_buffer;
+        }
+
+        /// Returns the number of bytes written to the instance since the last flush() or reset() call.
+        [[nodiscard]]
+        size_t get_transmitted_size() const
+        {
+            return _tx_size;
+        }
+
+        /**
+         * @brief Reads one byte from the reception buffer.
+         *
+         * @returns the read byte, or -1 if no readable bytes are available.
+         */
+        int read() override
+        {
+            if (_rx_readable == 0) return -1;
+            const uint8_t value = _rx_buffer[_rx_head];
+            _rx_head            = (_rx_head + 1) % kBufferSize;
+            _rx_size--;
+            _rx_readable--;
+            return value;
+        }
+
+        /**
+         * @brief Transfers up to the specified number of readable bytes from the reception buffer to the input buffer.
+         *
+         * @note Unlike the readBytes() Stream class method, this method does not use a timeout timer and instead
+         * returns immediately after transferring all readable bytes.
+         *
+         * @param buffer the buffer where to transfer the read bytes.
+         * @param length the maximum number of bytes to read.
+         * @returns the number of bytes read and written to the input buffer.
+         */
+        size_t readBytes(uint8_t* buffer, const size_t length)
+        {
+            const size_t bytes_to_read = min(length, static_cast<size_t>(_rx_readable));
+            const size_t first_chunk   = min(bytes_to_read, static_cast<size_t>(kBufferSize - _rx_head));
+            memcpy(buffer, &_rx_buffer[_rx_head], first_chunk);
+            memcpy(buffer + first_chunk, _rx_buffer, bytes_to_read - first_chunk);
+            _rx_head = (_rx_head + bytes_to_read) % kBufferSize;
+            _rx_size -= bytes_to_read;
+            _rx_readable -= bytes_to_read;
+            return bytes_to_read;
+        }
+
+        /**
+         * @brief Appends the requested number of bytes from the input buffer to the transmission buffer.
+         *
+         * @returns the number of bytes written, which is less than bytes_to_write if the transmission buffer becomes
+         * full.
+         */
+        size_t write(const uint8_t* buffer, const size_t bytes_to_write) override
+        {
+            const size_t bytes_written = min(bytes_to_write, static_cast<size_t>(kBufferSize - _tx_size));
+            memcpy(&_tx_buffer[_tx_size], buffer, bytes_written);
+            _tx_size += bytes_written;
+            return bytes_written;
+        }
+
+        /// Appends the input byte to the transmission buffer. Returns 1 if the byte was written and 0 otherwise.
+        size_t write(const uint8_t value) override
+        {
+            if (_tx_size == kBufferSize) return 0;
+            _tx_buffer[_tx_size++] = value;
+            return 1;
+        }
+
+        /// Returns the number of bytes that can be written before the transmission buffer becomes full.
+        int availableForWrite() override
+        {
+            return kBufferSize - _tx_size;
+        }
+
+        /// Returns the number of readable bytes stored in the reception buffer.
+        int available() override
+        {
+            return _rx_readable;
+        }
+
+        /// Returns the next readable byte without consuming it, or -1 if no readable bytes are available.
+        int peek() override
+        {
+            if (_rx_readable == 0) return -1;
+            return _rx_buffer[_rx_head];
+        }
+
+        /// Simulates the data being sent to the PC (flushed) by discarding the contents of the transmission buffer.
+        void flush() override
+        {
+            _tx_size = 0;
+        }
+
+        /// Discards the contents of both the transmission and the reception buffers.
+        void reset()
+        {
+            memset(_rx_invalid, 0, sizeof(_rx_invalid));
+            _rx_head     = 0;
+            _rx_size     = 0;
+            _rx_readable = 0;
+            _tx_size     = 0;
+        }
+
+    private:
+        /// Stores the reception buffer data.
+        uint8_t _rx_buffer[kBufferSize] {};
+
+        /// Stores the validity bitmap of the reception buffer. A set bit marks the corresponding byte as invalid.
+        uint8_t _rx_invalid[(kBufferSize + 7) / 8] {};
+
+        /// Stores the transmission buffer data.
+        uint8_t _tx_buffer[kBufferSize] {};
+
+        /// Stores the index of the next byte to read from the reception buffer.
+        uint16_t _rx_head = 0;
+
+        /// Stores the number of bytes stored in the reception buffer.
+        uint16_t _rx_size = 0;
+
+        /// Stores the number of contiguous valid bytes that start at the reception buffer's read position.
+        uint16_t _rx_readable = 0;
+
+        /// Stores the number of bytes stored in the transmission buffer.
+        uint16_t _tx_size = 0;
+
+        /// Determines whether the reception buffer byte at the specified index is marked as invalid.
+        [[nodiscard]]
+        bool IsInvalid(const uint16_t index) const
+        {
+            return _rx_invalid[index / 8] >> (index % 8) & 1;
+        }
+
+        /// Marks the reception buffer byte at the specified index as invalid or valid.
+        void SetInvalid(const uint16_t index, const bool invalid)
+        {
+            if (invalid)
+            {
+                _rx_invalid[index / 8] |= static_cast<uint8_t>(1 << (index % 8));
+            }
+            else
+            {
+                _rx_invalid[index / 8] &= static_cast<uint8_t>(~(1 << (index % 8)));
+            }
+        }
+};
+
 #endif  //AXTLMC_STREAM_MOCK_H
@@ -0,0 +1,270 @@
+/**
+ * @file
+ *
+ * @brief Provides the StreamingReceiver class that accumulates the received bytes in bulk and frames the packets by
+ * their delimiter bytes, without reading the payload size first.
+ *
+ * @section sr_description Description:
+ * The TransportLayer class parses each packet by reading its payload size and then waiting for exactly that many
+ * bytes, one byte at a time. The StreamingReceiver class instead appends the received bytes to a linear accumulation
+ * buffer in arbitrarily sized chunks and searches the accumulated bytes for the COBS delimiter byte. Once the delimiter
+ * byte (and, for the layouts that transmit the payload size, the checksum postamble) is accumulated, the packet is
+ * passed to the wrapped TransportLayer instance, which verifies its size and checksum and decodes its payload. The
+ * bytes that follow the packet are retained as the beginning of the next packet.
+ *
+ * Since the packets can be split across any number of chunks, the bytes can be read from the communication interface
+ * in bulk, whenever they become available, or written directly into the accumulation buffer by a DMA controller or a
+ * UART driver through the get_write_buffer() and CommitWrite() methods.
+ *
+ * @warning The accumulation buffer reserves twice the wrapped TransportLayer instance's reception buffer size of RAM by
+ * default. On boards with limited RAM, such as Arduino Mega, reduce the kBufferSize template parameter accordingly.
+ */
+
+#ifndef AXTLMC_STREAMING_RECEIVER_H
+#define AXTLMC_STREAMING_RECEIVER_H
+
+#include <Arduino.h>
+#include "axtlmc_shared_assets.h"
+
+using namespace axtlmc_shared_assets;
+
+/**
+ * @brief Frames the packets stored in the accumulated received bytes by their delimiter bytes and passes them to the
+ * wrapped TransportLayer instance.
+ *
+ * @warning The wrapped TransportLayer instance's ReceiveData() method must not be used while the instance is wrapped
+ * by this class.
+ *
+ * @tparam TransportType The type of the wrapped TransportLayer instance.
+ * @tparam kBufferSize The size of the accumulation buffer, in bytes. Must be at least the wrapped TransportLayer
+ * instance's reception buffer size, so that the buffer can store the largest packet.
+ */
+template <typename TransportType, const uint16_t kBufferSize = 2 * TransportType::get_reception_buffer_size()>
+class StreamingReceiver final
+{
+        static_assert(
+            kBufferSize >= TransportType::get_reception_buffer_size(),
+            "StreamingReceiver's kBufferSize template parameter must be at least the TransportLayer's reception buffer "
+            "size."
+        );
+
+    public:
+        /**
+         * @brief Initializes the instance's accumulation buffer.
+         *
+         * @param transport_layer The TransportLayer instance used to verify and decode the framed packets.
+         */
+        explicit StreamingReceiver(TransportType& transport_layer) : _transport(transport_layer)
+        {}
+
+        /**
+         * @brief Appends the input bytes to the accumulation buffer.
+         *
+         * @param data The buffer that stores the received bytes.
+         * @param size The number of received bytes.
+         * @returns the number of appended bytes, which is less than size if the accumulation buffer becomes full.
+         */
+        uint16_t Ingest(const uint8_t* data, const uint16_t size)
+        {
+            const uint16_t bytes_to_copy = min(size, get_free_space());
+            memcpy(&_buffer[_size], data, bytes_to_copy);
+            _size += bytes_to_copy;
+            return bytes_to_copy;
+        }
+
+        /**
+         * @brief Reads all bytes available from the input communication interface that fit into the accumulation
+         * buffer with a single bulk read.
+         *
+         * @param port The communication interface to read the bytes from.
+         * @returns the number of bytes read from the communication interface.
+         */
+        uint16_t Ingest(Stream& port)
+        {
+            const int available_bytes = port.available();
+            if (available_bytes <= 0 || get_free_space() == 0) return 0;
+
+            const auto bytes_to_read =
+                static_cast<uint16_t>(min(static_cast<size_t>(available_bytes), static_cast<size_t>(get_free_space())));
+            const auto bytes_read = static_cast<uint16_t>(port.readBytes(&_buffer[_size], bytes_to_read));
+            _size += bytes_read;
+            return bytes_read;
+        }
+
+        /// Returns the pointer to the free region at the end of the accumulation buffer. The bytes written to this
+        /// region are appended to the accumulated bytes by the CommitWrite() method.
+        [[nodiscard]]
+        uint8_t* get_write_buffer()
+        {
+            return &_buffer[_size];
+        }
+
+        /// Appends the input number of bytes written to the region returned by the get_write_buffer() method to the
+        /// accumulated bytes. The number of bytes is capped at the free space of the accumulation buffer.
+        void CommitWrite(const uint16_t size)
+        {
+            _size += min(size, get_free_space());
+        }
+
+        /**
+         * @brief Frames the oldest complete packet stored in the accumulated bytes and passes it to the wrapped
+         * TransportLayer instance, which verifies its integrity and decodes its payload into the instance's reception
+         * buffer.
+         *
+         * Once this method returns true, the payload can be read using the wrapped TransportLayer instance's
+         * ReadData() method. Each call processes at most one packet, so call this method until it returns false with
+         * the kNoPacketsFramed status to process all accumulated packets.
+         *
+         * @note If the accumulation buffer becomes full without storing a complete packet, the accumulated bytes are
+         * discarded and the runtime status is set to kBufferOverflow.
+         *
+         * @returns true if the packet was successfully verified and unpacked, or false if no complete packet is
+         * accumulated or the packet is corrupted.
+         */
+        bool ReceiveData()
+        {
+            // Discards the bytes that precede the start byte, as they cannot belong to a packet.
+            if (Layout::kHasStartByte)
+            {
+                const auto* start_byte = static_cast<const uint8_t*>(memchr(_buffer, Layout::kStartByte, _size));
+                Consume(start_byte == nullptr ? _size : static_cast<uint16_t>(start_byte - _buffer));
+            }
+
+            // The payload size field precedes the COBS frame and may store the delimiter byte value (the upper byte of
+            // the 2-byte fields is always 0), so it is verified before the frame is searched for the delimiter byte.
+            if (!Layout::kIsDelimiterFramed)
+            {
+                if (_size < kFrameOffset)
+                {
+                    _runtime_status = static_cast<uint8_t>(kStreamingReceiverStatusCodes::kNoPacketsFramed);
+                    return false;
+                }
+
+                // If the packet starts with the start byte, the start byte is discarded, as it may have been noise
+                // that precedes the actual packet. The size field is passed to the TransportLayer instance, which
+                // rejects it and records the reception error. The packets without the start byte resynchronize with
+                // the packet stream at the next delimiter byte instead.
+                if (Layout::kHasStartByte && !IsPayloadSizeValid())
+                {
+                    _transport.ReceiveFramedPacket(&_buffer[kPacketOffset], Layout::kPayloadSizeWidth);
+                    Consume(1);
+                    _runtime_status = static_cast<uint8_t>(kStreamingReceiverStatusCodes::kPacketRejected);
+                    return false;
+                }
+            }
+
+            // Resumes the delimiter search at the first frame byte that was not searched by the previous calls.
+            const uint16_t scan_start = max(_scan_index, kFrameOffset);
+            const auto* delimiter     = static_cast<const uint8_t*>(
+                memchr(&_buffer[scan_start], Layout::kDelimiterByte, _size - scan_start)
+            );
+            const uint16_t delimiter_index = delimiter == nullptr ? _size : static_cast<uint16_t>(delimiter - _buffer);
+
+            // For the layouts that transmit the payload size, the checksum postamble only follows the delimiter byte
+            // found at the position announced by the payload size. Any other delimiter byte ends a malformed packet,
+            // so that noise that ends with the delimiter byte does not consume the bytes of the following packet.
+            const bool size_matches =
+                !Layout::kIsDelimiterFramed &&
+                delimiter_index == kFrameOffset + 1 + _buffer[kPacketOffset];
+            const uint16_t packet_end = delimiter_index + 1 + (size_matches ? kPostambleSize : 0);
+            if (delimiter == nullptr || packet_end > _size)
+            {
+                _scan_index = delimiter_index;
+                if (_size == kBufferSize)
+                {
+                    Consume(_size);
+                    _runtime_status = static_cast<uint8_t>(kStreamingReceiverStatusCodes::kBufferOverflow);
+                    return false;
+                }
+                _runtime_status = static_cast<uint8_t>(kStreamingReceiverStatusCodes::kNoPacketsFramed);
+                return false;
+            }
+
+            const bool received = _transport.ReceiveFramedPacket(&_buffer[kPacketOffset], packet_end - kPacketOffset);
+
+            // Rejected packets that start with the start byte are discarded up to and including the start byte, as
+            // the start byte may have been noise that precedes the actual packet. All other packets are discarded up to
+            // and including their last byte.
+            Consume(!received && Layout::kHasStartByte ? 1 : packet_end);
+            _runtime_status = static_cast<uint8_t>(
+                received ? kStreamingReceiverStatusCodes::kPacketReceived
+                         : kStreamingReceiverStatusCodes::kPacketRejected
+            );
+            return received;
+        }
+
+        /// Returns the number of accumulated bytes that were not yet framed into packets.
+        [[nodiscard]]
+        uint16_t get_buffered_bytes() const
+        {
+            return _size;
+        }
+
+        /// Returns the number of bytes that can be appended to the accumulation buffer.
+        [[nodiscard]]
+        uint16_t get_free_space() const
+        {
+            return kBufferSize - _size;
+        }
+
+        /// Returns the runtime status of the most recently called ReceiveData() method.
+        [[nodiscard]]
+        uint8_t get_runtime_status() const
+        {
+            return _runtime_status;
+        }
+
+    private:
+        /// Stores the PacketLayout of the framed packets.
+        using Layout = typename TransportType::Layout;
+
+        /// Stores the number of checksum postamble bytes that follow the delimiter byte.
+        static constexpr uint8_t kPostambleSize = TransportType::get_postamble_size();
+
+        /// Stores the offset of the first framed packet byte passed to the TransportLayer instance. The start byte is
+        /// not passed to the instance.
+        static constexpr uint8_t kPacketOffset = Layout::kHasStartByte ? 1 : 0;
+
+        /// Stores the offset of the COBS frame's overhead byte. The bytes that precede it are not searched for the
+        /// delimiter byte.
+        static constexpr uint16_t kFrameOffset = kPacketOffset + Layout::kPayloadSizeWidth;
+
+        /// Determines whether the accumulated payload size field stores a payload size that the wrapped TransportLayer
+        /// instance can receive.
+        [[nodiscard]]
+        bool IsPayloadSizeValid() const
+        {
+            const uint8_t payload_size = _buffer[kPacketOffset];
+            return payload_size >= Layout::kMinimumPayloadSize + TransportType::get_sequence_number_size() &&
+                   payload_size <= TransportType::get_maximum_received_payload_size() +
+                                       TransportType::get_sequence_number_size() &&
+                   (Layout::kPayloadSizeWidth < 2 || _buffer[kPacketOffset + 1] == 0);
+        }
+
+        /// Removes the input number of bytes from the beginning of the accumulation buffer, moving the remaining bytes
+        /// to the beginning of the buffer.
+        void Consume(const uint16_t size)
+        {
+            if (size == 0) return;
+            _size -= size;
+            memmove(_buffer, &_buffer[size], _size);
+            _scan_index = 0;
+        }
+
+        /// The reference to the TransportLayer instance that verifies and decodes the framed packets.
+        TransportType& _transport;
+
+        /// Stores the accumulated received bytes.
+        uint8_t _buffer[kBufferSize] {};
+
+        /// Stores the number of accumulated bytes.
+        uint16_t _size = 0;
+
+        /// Stores the index of the first accumulated byte that was not yet searched for the delimiter byte.
+        uint16_t _scan_index = 0;
+
+        /// Stores the runtime status of the most recently called ReceiveData() method.
+        uint8_t _runtime_status = static_cast<uint8_t>(kStreamingReceiverStatusCodes::kStandby);
+};
+
+#endif  //AXTLMC_STREAMING_RECEIVER_H
@@ -0,0 +1,211 @@
+/**
+ * @file
+ *
+ * @brief Provides the TransmissionQueue class that stores pre-encoded packets and transmits them in the background,
+ * without blocking the application while the communication interface is busy.
+ *
+ * @section tq_description Description:
+ * The TransmissionQueue class wraps a TransportLayer instance. Each packet sent through the queue is COBS-encoded and
+ * CRC-stamped immediately and appended to the queue's byte buffer. The queued bytes are transmitted by the Poll()
+ * method, which writes as many bytes as the communication interface can accept without blocking. Since the queued
+ * packets are stored back-to-back, all packets that fit into the communication interface's free space are transmitted
+ * with a single write() call, which reduces the number of USB transactions when multiple packets are queued.
+ *
+ * @warning The queue relies on the communication interface's availableForWrite() method to avoid blocking. Interfaces
+ * that do not implement this method always report 0 available bytes, so the queued data is never transmitted.
+ */
+
+#ifndef AXTLMC_TRANSMISSION_QUEUE_H
+#define AXTLMC_TRANSMISSION_QUEUE_H
+
+#include <Arduino.h>
+#include "axtlmc_shared_assets.h"
+
+using namespace axtlmc_shared_assets;
+
+/**
+ * @brief Stores the packets encoded by the wrapped TransportLayer instance and transmits them as the communication
+ * interface's transmission buffer space becomes available.
+ *
+ * @tparam TransportType The type of the wrapped TransportLayer instance.
+ * @tparam kBufferSize The size of the queue's byte buffer. Must be at least as large as the wrapped TransportLayer's
+ * transmission buffer, which is the space reserved for each encoded packet. Defaults to the space for two
+ * maximum-sized packets.
+ */
+template <typename TransportType, const uint16_t kBufferSize = 2 * TransportType::get_transmission_buffer_size()>
+class TransmissionQueue final
+{
+        static_assert(
+            kBufferSize >= TransportType::get_transmission_buffer_size(),
+            "TransmissionQueue's kBufferSize template parameter must be at least equal to the wrapped TransportLayer's "
+            "transmission buffer size."
+        );
+
+    public:
+        /**
+         * @brief Initializes the instance's queue trackers.
+         *
+         * @param transport_layer The TransportLayer instance used to encode and transmit the queued packets.
+         */
+        explicit TransmissionQueue(TransportType& transport_layer) : _transport(transport_layer)
+        {}
+
+        /**
+         * @brief Serializes and writes the input object's data to the end of the payload of the next queued packet.
+         *
+         * @tparam ObjectType The datatype of the object to write to the payload.
+         * @param object The object to write to the payload.
+         * @param object_size The size of the object, in bytes.
+         * @returns true if the object's data was written to the payload, or false if the wrapped TransportLayer's
+         * transmission buffer lacks space for the object.
+         */
+        template <typename ObjectType>
+        bool WriteData(const ObjectType& object, const uint16_t object_size = sizeof(ObjectType))
+        {
+            return _transport.WriteData(object, object_size);
+        }
+
+        /**
+         * @brief Encodes the staged payload into a packet and adds it to the queue, without transmitting it.
+         *
+         * @note Regardless of the staged payload size, the queue must have enough free space to store the
+         * maximum-sized packet. If the queue is full, the staged payload is kept, so the call can be repeated after
+         * the Poll() method transmits some of the queued data.
+         *
+         * @returns true if the packet was added to the queue, or false if the queue is full.
+         */
+        bool SendData()
+        {
+            // Moves the queued bytes to the beginning of the buffer if the free space at its end is insufficient.
+            if (kBufferSize - _end < kPacketSpace && _start > 0)
+            {
+                memmove(_buffer, &_buffer[_start], _end - _start);
+                _end -= _start;
+                _start = 0;
+            }
+
+            const uint16_t packet_size = _transport.EncodeData(&_buffer[_end], kBufferSize - _end);
+            if (packet_size == 0)
+            {
+                _runtime_status = static_cast<uint8_t>(kTransmissionQueueStatusCodes::kQueueFull);
+                return false;
+            }
+
+            _end += packet_size;
+            _queued_packets++;
+            _runtime_status = static_cast<uint8_t>(kTransmissionQueueStatusCodes::kPacketQueued);
+            return true;
+        }
+
+        /**
+         * @brief Transmits as many queued bytes as the communication interface can accept without blocking.
+         *
+         * @note This method should be called cyclically (as part of a loop) while the queue stores any data.
+         *
+         * @returns the number of transmitted bytes.
+         */
+        uint16_t Poll()
+        {
+            if (_start == _end)
+            {
+                _runtime_status = static_cast<uint8_t>(kTransmissionQueueStatusCodes::kQueueDrained);
+                return 0;
+            }
+
+            const uint16_t bytes_written = _transport.TrySendEncodedData(&_buffer[_start], _end - _start);
+            _start += bytes_written;
+            if (bytes_written > 0) _write_calls++;
+
+            // Restarts filling the buffer from its beginning once all queued bytes are transmitted.
+            if (_start == _end)
+            {
+                _start          = 0;
+                _end            = 0;
+                _runtime_status = static_cast<uint8_t>(kTransmissionQueueStatusCodes::kQueueDrained);
+            }
+            else if (bytes_written > 0)
+            {
+                _runtime_status = static_cast<uint8_t>(kTransmissionQueueStatusCodes::kPartiallyDrained);
+            }
+            else
+            {
+                _runtime_status = static_cast<uint8_t>(kTransmissionQueueStatusCodes::kInterfaceBusy);
+            }
+            return bytes_written;
+        }
+
+        /// Blocks until all queued bytes are transmitted.
+        void Flush()
+        {
+            while (_start != _end) Poll();
+        }
+
+        /// Discards all queued bytes, including the remaining bytes of any partially transmitted packet.
+        void Clear()
+        {
+            _start = 0;
+            _end   = 0;
+        }
+
+        /// Returns the number of queued bytes that were not yet transmitted.
+        [[nodiscard]]
+        uint16_t get_queued_bytes() const
+        {
+            return _end - _start;
+        }
+
+        /// Returns the size of the queue's byte buffer, in bytes.
+        [[nodiscard]]
+        static constexpr uint16_t get_buffer_size()
+        {
+            return kBufferSize;
+        }
+
+        /// Returns the total number of packets added to the queue.
+        [[nodiscard]]
+        uint32_t get_queued_packets() const
+        {
+            return _queued_packets;
+        }
+
+        /// Returns the total number of write() calls used to transmit the queued data.
+        [[nodiscard]]
+        uint32_t get_write_calls() const
+        {
+            return _write_calls;
+        }
+
+        /// Returns the runtime status of the most recently called method.
+        [[nodiscard]]
+        uint8_t get_runtime_status() const
+        {
+            return _runtime_status;
+        }
+
+    private:
+        /// Stores the buffer space reserved for each encoded packet, in bytes.
+        static constexpr uint16_t kPacketSpace = TransportType::get_transmission_buffer_size();
+
+        /// The reference to the TransportLayer instance that encodes and transmits the queued packets.
+        TransportType& _transport;
+
+        /// Stores the queued packet data.
+        uint8_t _buffer[kBufferSize] {};
+
+        /// Stores the index of the first queued byte that was not yet transmitted.
+        uint16_t _start = 0;
+
+        /// Stores the index that immediately follows the last queued byte.
+        uint16_t _end = 0;
+
+        /// Tracks the total number of queued packets.
+        uint32_t _queued_packets = 0;
+
+        /// Tracks the total number of write() calls used to transmit the queued data.
+        uint32_t _write_calls = 0;
+
+        /// Stores the runtime status of the most recently called method.
+        uint8_t _runtime_status = static_cast<uint8_t>(kTransmissionQueueStatusCodes::kStandby);
+};
+
+#endif  //AXTLMC_TRANSMISSION_QUEUE_H
@@ -11,12 +11,21 @@
  *
  * @section tl_packet_anatomy Packet Anatomy:
  * This class sends and receives data in the form of packets. Each packet adheres to the following general layout:
- * [START BYTE] [PAYLOAD SIZE] [OVERHEAD BYTE] [PAYLOAD] [DELIMITER BYTE] [CRC CHECKSUM]
+ * [START BYTE] [PAYLOAD SIZE] [OVERHEAD BYTE] [SEQUENCE NUMBER] [PAYLOAD] [DELIMITER BYTE] [CRC CHECKSUM]
+ *
+ * The [SEQUENCE NUMBER] header extension is optional and is only present when the class is configured to use 8- or
+ * 16-bit packet sequence numbers. When present, it is stored in little-endian order inside the COBS-encoded region of
+ * the packet, so it is protected by the CRC checksum and is counted by the [PAYLOAD SIZE] byte.
+ *
+ * The layout above is the default PacketLayout. The LayoutType template parameter selects other layouts at compile
+ * time, such as the layouts without the [START BYTE], with a 2-byte little-endian [PAYLOAD SIZE] field, or with a
+ * non-zero [DELIMITER BYTE] value.
  *
  * @warning This class permanently reserves up to 524 bytes of RAM for the staging buffers and up to 1024 bytes for
  * storing the CRC lookup table. The number of bytes reserved for the staging buffers can be reduced by adjusting the
  * maximum transmission / reception buffer sizes. The number of bytes reserved for the CRC lookup table can be reduced
- * by adjusting the type of the polynomial used for the CRC checksum calculation.
+ * by adjusting the type of the polynomial used for the CRC checksum calculation or eliminated by storing the table in
+ * flash via the ChecksumEngineType template parameter.
  *
  * @note All user-facing methods only work with the payload portion of the data packet. The rest of the packet anatomy
  * is controlled internally by the TransportLayer instance.
@@ -30,6 +39,8 @@
 #include "axtlmc_shared_assets.h"
 #include "cobs_processor.h"
 #include "crc_processor.h"
+#include "fletcher_processor.h"
+#include "latency_histogram.h"
 
 using namespace axtlmc_shared_assets;
 
@@ -67,6 +78,10 @@ static constexpr uint16_t kSerialBufferSize = 256;
     defined(__AVR_ATmega168__) || defined(__AVR_ATmega1280__) || defined(__AVR_ATmega16U4__)
 static constexpr uint16_t kSerialBufferSize = 64;
 
+// Host PC builds that use the shim from the extras/host directory (fuzzing harnesses and native tests).
+#elif defined(AXTLMC_HOST_SHIM)
+static constexpr uint16_t kSerialBufferSize = 8192;
+
 // The default fallback for unsupported boards is the reasonable minimum buffer size
 #else
 static constexpr uint16_t kSerialBufferSize = 64;
@@ -87,11 +102,25 @@ static constexpr uint16_t kSerialBufferSize = 64;
  * 1 and 254.
  * @tparam kMaximumReceivedPayloadSize The maximum size of the payload that is expected to be received during runtime.
  * This parameter indirectly controls the size of the instance's reception buffer. Must be a value between 1 and 254.
+ * @tparam kSequenceNumberSize The size of the sequence number header extension, in bytes. Valid values are 0 (no
+ * sequence numbers), 1 (8-bit sequence numbers), and 2 (16-bit sequence numbers). The sequence number occupies the
+ * first bytes of each packet's payload region, so the maximum payload sizes combined with this value must not exceed
+ * 254.
+ * @tparam ChecksumEngineType The engine used to calculate and verify the packet checksums. Defaults to the
+ * CRCProcessor that stores its lookup table in RAM. Use
+ * CRCProcessor<PolynomialType, CRCFlashTableKernel<PolynomialType, kPolynomial>> to store the CRC lookup table in flash
+ * instead, or any other class that implements the checksum engine interface described by the CRCProcessor class. The
+ * engine's ChecksumType must match the PolynomialType, and its kChecksumSize determines the size of the postamble.
+ * @tparam LayoutType The PacketLayout that defines the packet's preamble and delimiter byte. Defaults to the layout
+ * described in the file documentation. Both communicating parties must use the same layout.
  */
 template <
     typename PolynomialType                      = uint8_t,                          // Defaults to uint8_t polynomials
     const uint8_t kMaximumTransmittedPayloadSize = min(kSerialBufferSize - 8, 254),  // Intelligently caps at 254 bytes
-    const uint8_t kMaximumReceivedPayloadSize    = min(kSerialBufferSize - 8, 254)   // Intelligently caps at 254 bytes
+    const uint8_t kMaximumReceivedPayloadSize    = min(kSerialBufferSize - 8, 254),  // Intelligently caps at 254 bytes
+    const uint8_t kSequenceNumberSize            = 0,                                // Disables sequence numbers
+    typename ChecksumEngineType                  = CRCProcessor<PolynomialType>,     // Stores the CRC table in RAM
+    typename LayoutType                          = kBufferLayout                     // Uses the default packet layout
     >
 class TransportLayer final
 {
@@ -123,33 +152,94 @@ class TransportLayer final
             "TransportLayer's kMaximumReceivedPayloadSize template parameter must be greater than 0."
         );
 
+        // Verifies that the sequence number header extension uses one of the supported widths and that it fits into
+        // the COBS-encoded payload region together with the largest transmitted and received payloads.
+        static_assert(
+            kSequenceNumberSize <= 2,
+            "TransportLayer's kSequenceNumberSize template parameter must be 0, 1, or 2."
+        );
+        static_assert(
+            kMaximumTransmittedPayloadSize + kSequenceNumberSize < 255,
+            "TransportLayer's kMaximumTransmittedPayloadSize and kSequenceNumberSize template parameters must add up "
+            "to less than 255."
+        );
+        static_assert(
+            kMaximumReceivedPayloadSize + kSequenceNumberSize < 255,
+            "TransportLayer's kMaximumReceivedPayloadSize and kSequenceNumberSize template parameters must add up to "
+            "less than 255."
+        );
+
+        // Ensures that the checksum engine calculates checksums of the same type as the instance's polynomial and that
+        // the checksum fits into its postamble.
+        static_assert(
+            is_same_v<typename ChecksumEngineType::ChecksumType, PolynomialType>,
+            "TransportLayer's ChecksumEngineType template parameter must calculate checksums of the PolynomialType."
+        );
+        static_assert(
+            ChecksumEngineType::kChecksumSize > 0 && ChecksumEngineType::kChecksumSize <= sizeof(PolynomialType),
+            "TransportLayer's ChecksumEngineType template parameter must use a checksum size between 1 and the size "
+            "of the PolynomialType."
+        );
+
+        // Delimiter-framed packets COBS-encode the checksum together with the payload, so the checksum also has to fit
+        // into the encoded payload region.
+        static_assert(
+            !LayoutType::kIsDelimiterFramed ||
+                (kMaximumTransmittedPayloadSize + kSequenceNumberSize + ChecksumEngineType::kChecksumSize < 255 &&
+                 kMaximumReceivedPayloadSize + kSequenceNumberSize + ChecksumEngineType::kChecksumSize < 255),
+            "TransportLayer's maximum payload sizes, kSequenceNumberSize, and checksum size must add up to less than "
+            "255 when the LayoutType is delimiter-framed."
+        );
+
     public:
+        /// The datatype of the checksums calculated by the instance.
+        using ChecksumType = PolynomialType;
+
+        /// The PacketLayout used by the instance's packets.
+        using Layout = LayoutType;
+
         /**
          * @brief Initializes all runtime assets that facilitate data transmission and reception.
          *
-         * @note The constructor seeds the transmission buffer's first byte with the protocol start byte value.
+         * @note If the instance's layout uses the start byte, the constructor seeds the transmission buffer's first
+         * byte with the protocol start byte value.
          *
          * @param communication_port The initialized communication interface instance, such as Serial or USB Serial.
          * @param crc_polynomial The polynomial to use for the generation of the CRC lookup table. The polynomial must
-         * be standard (non-reflected / non-reversed). Defaults to 0x07.
+         * be standard (non-reflected / non-reversed). Defaults to the compile-time polynomial of the checksum engines
+         * that generate their lookup table at compile time, such as the CRCFlashTableKernel, and to 0x07 otherwise.
          * @param crc_initial_value The value to which the CRC checksum is initialized before calculation. Defaults to
          * 0x00.
          * @param crc_final_xor_value The value with which the CRC checksum is XORed after calculation. Defaults to
          * 0x00.
+         * @param baud_rate The baud rate of the communication interface, used to derive the reception timeouts. See
+         * the SetBaudRate() method for details. Defaults to 0, which uses the fixed 10 ms inter-byte timeout.
          */
         explicit TransportLayer(
             Stream& communication_port,
-            const PolynomialType crc_polynomial      = 0x07,
+            const PolynomialType crc_polynomial      = default_polynomial<ChecksumEngineType, PolynomialType>::value,
             const PolynomialType crc_initial_value   = 0x00,
-            const PolynomialType crc_final_xor_value = 0x00
+            const PolynomialType crc_final_xor_value = 0x00,
+            const uint32_t baud_rate                 = 0
         ) :
             _port(communication_port),
-            _crc_processor(crc_polynomial, crc_initial_value, crc_final_xor_value),
+            _checksum_engine(crc_polynomial, crc_initial_value, crc_final_xor_value),
             _transmission_buffer {},
             _reception_buffer {}
         {
             // Seeds the transmission buffer's first byte with the protocol start byte value.
-            _transmission_buffer[kBufferLayout::kStartByteIndex] = kBufferLayout::kStartByte;
+            if (LayoutType::kHasStartByte) _transmission_buffer[LayoutType::kStartByteIndex] = LayoutType::kStartByte;
+
+            // Derives the reception timeouts from the baud rate of the communication interface.
+            SetBaudRate(baud_rate);
+
+            // Reports the checksum engines that cannot use the requested CRC polynomial, such as the CRC engines that
+            // generate their lookup table for a different polynomial at compile time. The mismatch also remains
+            // available through the has_polynomial_mismatch() method after the runtime status is overwritten.
+            if (has_polynomial_mismatch())
+            {
+                _runtime_status = static_cast<uint8_t>(kTransportStatusCodes::kPolynomialMismatch);
+            }
         }
 
         /**
@@ -162,21 +252,21 @@ class TransportLayer final
         [[nodiscard]]
         bool Available() const
         {
-            return _port.available() >= static_cast<int>(kMinimumPacketSize);
+            return BytesAvailable() >= static_cast<int>(kMinimumPacketSize);
         }
 
         /// Resets the instance's transmission buffer.
         void ResetTransmissionBuffer()
         {
-            _transmission_buffer[kBufferLayout::kPayloadSizeIndex]  = 0;
-            _transmission_buffer[kBufferLayout::kOverheadByteIndex] = 0;
+            _transmission_buffer[LayoutType::kPayloadSizeIndex]  = 0;
+            _transmission_buffer[LayoutType::kOverheadByteIndex] = 0;
         }
 
         /// Resets the instance's reception buffer.
         void ResetReceptionBuffer()
         {
-            _reception_buffer[kBufferLayout::kPayloadSizeIndex]  = 0;
-            _reception_buffer[kBufferLayout::kOverheadByteIndex] = 0;
+            _reception_buffer[LayoutType::kPayloadSizeIndex]  = 0;
+            _reception_buffer[LayoutType::kOverheadByteIndex] = 0;
             _consumed_payload_bytes                              = 0;  // Also resets the consumed payload bytes counter
         }
 
@@ -235,7 +325,7 @@ class TransportLayer final
         bool CopyTxBufferPayloadToRxBuffer()
         {
             // Ensures that the payload to copy fits inside the reception buffer's payload region.
-            if (_transmission_buffer[kBufferLayout::kPayloadSizeIndex] > kMaximumReceivedPayloadSize)
+            if (_transmission_buffer[LayoutType::kPayloadSizeIndex] > kMaximumReceivedPayloadSize)
             {
                 return false;
             }
@@ -243,14 +333,14 @@ class TransportLayer final
             // Copies the payload from the transmission buffer to the reception buffer. Note that this excludes most
             // metadata and the CRC checksum postamble.
             memcpy(
-                &_reception_buffer[kBufferLayout::kPayloadStartIndex],
-                &_transmission_buffer[kBufferLayout::kPayloadStartIndex],
-                _transmission_buffer[kBufferLayout::kPayloadSizeIndex]
+                &_reception_buffer[kDataStartIndex],
+                &_transmission_buffer[kDataStartIndex],
+                _transmission_buffer[LayoutType::kPayloadSizeIndex]
             );
 
             // Updates the payload_size tracker of the reception buffer to match the copied payload size.
-            _reception_buffer[kBufferLayout::kPayloadSizeIndex] =
-                _transmission_buffer[kBufferLayout::kPayloadSizeIndex];
+            _reception_buffer[LayoutType::kPayloadSizeIndex] =
+                _transmission_buffer[LayoutType::kPayloadSizeIndex];
 
             return true;
         }
@@ -259,14 +349,14 @@ class TransportLayer final
         [[nodiscard]]
         uint8_t get_bytes_in_transmission_buffer() const
         {
-            return _transmission_buffer[kBufferLayout::kPayloadSizeIndex];
+            return _transmission_buffer[LayoutType::kPayloadSizeIndex];
         }
 
         /// Returns the size of the payload currently stored in the instance's reception buffer, in bytes.
         [[nodiscard]]
         uint8_t get_bytes_in_reception_buffer() const
         {
-            return _reception_buffer[kBufferLayout::kPayloadSizeIndex];
+            return _reception_buffer[LayoutType::kPayloadSizeIndex];
         }
 
         /// Returns the maximum size of the payload, in bytes, that fits into the instance's transmission buffer.
@@ -297,6 +387,44 @@ class TransportLayer final
             return kReceptionBufferSize;
         }
 
+        /// Returns the size of the sequence number header extension used by the instance, in bytes.
+        [[nodiscard]]
+        static constexpr uint8_t get_sequence_number_size()
+        {
+            return kSequenceNumberSize;
+        }
+
+        /// Returns the size of the CRC checksum postamble appended to each packet, in bytes.
+        [[nodiscard]]
+        static constexpr uint8_t get_postamble_size()
+        {
+            return kPostambleSize;
+        }
+
+        /// Returns a reference to the communication interface used by the instance. Used by the classes that read and
+        /// frame the received bytes themselves before passing the packets to the ReceiveFramedPacket() method.
+        [[nodiscard]]
+        Stream& get_port() const
+        {
+            return _port;
+        }
+
+        /// Returns a const reference to the checksum engine instance used to calculate the packet checksums.
+        [[nodiscard]]
+        const ChecksumEngineType& get_checksum_engine() const
+        {
+            return _checksum_engine;
+        }
+
+        /// Returns true if the instance's checksum engine cannot use the CRC polynomial passed to the constructor and
+        /// calculates the checksums for a different polynomial instead. Packets exchanged with the peers that use the
+        /// requested polynomial fail the checksum verification in this case.
+        [[nodiscard]]
+        bool has_polynomial_mismatch() const
+        {
+            return HasPolynomialMismatch(_checksum_engine, 0);
+        }
+
         /// Returns the runtime status of the most recently called method.
         [[nodiscard]]
         uint8_t get_runtime_status() const
@@ -304,19 +432,539 @@ class TransportLayer final
             return _runtime_status;
         }
 
+        /// Returns the sequence number of the most recently received packet. Always returns 0 if the instance does not
+        /// use sequence numbers.
+        [[nodiscard]]
+        uint16_t get_received_sequence_number() const
+        {
+            return _received_sequence_number;
+        }
+
+        /// Returns the sequence number that will be assigned to the next transmitted packet. Always returns 0 if the
+        /// instance does not use sequence numbers.
+        [[nodiscard]]
+        uint16_t get_transmitted_sequence_number() const
+        {
+            return _transmitted_sequence_number;
+        }
+
+        /**
+         * @brief Returns the counters that track the gaps, duplicates, and reordering of the received packets' sequence
+         * numbers.
+         *
+         * @note The counters are only updated if the instance uses sequence numbers (kSequenceNumberSize is not 0).
+         */
+        [[nodiscard]]
+        const SequenceStatistics& get_sequence_statistics() const
+        {
+            return _sequence_statistics;
+        }
+
+        /**
+         * @brief Resets the sequence number counters and restarts sequence number tracking.
+         *
+         * After calling this method, the next received packet's sequence number is used as the new tracking reference
+         * and is not evaluated for gaps.
+         */
+        void ResetSequenceStatistics()
+        {
+            _sequence_statistics      = SequenceStatistics {};
+            _sequence_synchronized    = false;
+            _received_sequence_window = 0;
+        }
+
+        /// Returns the number of bytes discarded while searching for the start byte of the incoming packets. Bytes
+        /// received between packets usually come from line noise or from packets interrupted by a reset.
+        [[nodiscard]]
+        uint32_t get_skipped_bytes() const
+        {
+            return _skipped_bytes;
+        }
+
+        /// Resets the counter of bytes discarded while searching for the start byte of the incoming packets.
+        void ResetSkippedBytes()
+        {
+            _skipped_bytes = 0;
+        }
+
+        /**
+         * @brief Derives the timeouts used when receiving the incoming packets from the baud rate of the communication
+         * interface.
+         *
+         * The time to transfer one byte is calculated assuming 8N1 framing (10 bits per byte). The inter-byte timeout
+         * is set to the time it takes to transfer kTimeoutSlackBytes bytes plus kTimeoutMargin microseconds. Each
+         * packet also receives a whole-packet budget equal to the inter-byte timeout plus the time it takes to
+         * transfer all packet bytes, which is calculated once the payload size byte of the packet is received.
+         *
+         * @note The baud rate only applies to UART interfaces. USB interfaces, such as the Teensy and Arduino Due
+         * native USB ports, ignore the baud rate and should use the default fixed timeout or the SetTimeouts()
+         * method.
+         *
+         * @warning The derived timeouts assume that the sender transmits each packet without pauses. Senders that
+         * transmit through buffering USB-to-UART adapters may introduce multi-millisecond gaps inside the packets and
+         * should use the SetTimeouts() method to configure more permissive timeouts.
+         *
+         * @param baud_rate The baud rate of the communication interface. Setting this to 0 restores the default fixed
+         * 10 ms inter-byte timeout and disables the whole-packet budget.
+         */
+        void SetBaudRate(const uint32_t baud_rate)
+        {
+            if (baud_rate == 0)
+            {
+                SetTimeouts(kDefaultTimeout, 0);
+                return;
+            }
+
+            const uint32_t byte_transfer_time = (kBitsPerByte * 1000000UL + baud_rate - 1) / baud_rate;
+            SetTimeouts(kTimeoutMargin + byte_transfer_time * kTimeoutSlackBytes, byte_transfer_time);
+        }
+
+        /**
+         * @brief Sets the timeouts used when receiving the incoming packets.
+         *
+         * @param inter_byte_timeout The maximum number of microseconds to wait between receiving any two consecutive
+         * bytes of the packet before abandoning the packet.
+         * @param byte_transfer_time The number of microseconds it takes to transfer one byte, used to calculate the
+         * whole-packet budget. Setting this to 0 disables the whole-packet budget.
+         */
+        void SetTimeouts(const uint32_t inter_byte_timeout, const uint32_t byte_transfer_time)
+        {
+            _inter_byte_timeout = inter_byte_timeout;
+            _byte_transfer_time = byte_transfer_time;
+        }
+
+        /// Returns the maximum number of microseconds to wait between receiving two consecutive bytes of the packet.
+        [[nodiscard]]
+        uint32_t get_inter_byte_timeout() const
+        {
+            return _inter_byte_timeout;
+        }
+
+        /// Returns the number of microseconds it takes to transfer one byte. 0 means the whole-packet budget is
+        /// disabled.
+        [[nodiscard]]
+        uint32_t get_byte_transfer_time() const
+        {
+            return _byte_transfer_time;
+        }
+
+        /**
+         * @brief Attaches the histograms used to record the latencies of the received and transmitted packets.
+         *
+         * The reception latency is the time from finding the start byte of the packet to the successful end of the
+         * ReceiveData() method. The transmission latency is the time from entering a SendData() method to the
+         * communication interface accepting the last byte of the packet.
+         *
+         * @note Histograms are not attached by default. Each attached histogram adds two micros() calls to every
+         * received or transmitted packet.
+         *
+         * @param reception_histogram The histogram that records the reception latencies, or nullptr to stop recording
+         * them.
+         * @param transmission_histogram The histogram that records the transmission latencies, or nullptr to stop
+         * recording them.
+         */
+        void SetLatencyHistograms(LatencyHistogram* reception_histogram, LatencyHistogram* transmission_histogram)
+        {
+            _reception_histogram    = reception_histogram;
+            _transmission_histogram = transmission_histogram;
+        }
+
+        /// Returns the counters that track the health of the communication link.
+        [[nodiscard]]
+        const LinkStatistics& get_link_statistics() const
+        {
+            return _link_statistics;
+        }
+
+        /// Resets the counters that track the health of the communication link.
+        void ResetLinkStatistics()
+        {
+            _link_statistics = LinkStatistics {};
+        }
+
+        /**
+         * @brief Sends the telemetry packet that describes the health of the communication link to the PC.
+         *
+         * The telemetry packet uses the following payload layout:
+         * [PACKET TYPE] [FORMAT VERSION] [FIELD COUNT] [MAXIMUM TRANSMITTED PAYLOAD SIZE] [MAXIMUM RECEIVED PAYLOAD
+         * SIZE] [SEQUENCE NUMBER SIZE] [POSTAMBLE SIZE] [FIELDS]
+         *
+         * The packet type is kReservedPacketTypes::kTelemetry. Each field is a little-endian 32-bit value. The fields
+         * are, in order: the uptime in milliseconds, the transmitted packets, the received packets, the checksum
+         * errors, the timeout errors, the framing errors, the skipped bytes, the missing sequence numbers, the
+         * reception backlog peak, the largest received and transmitted payload sizes, and the 50th percentile, 99th
+         * percentile, and maximum latencies recorded by the reception and the transmission histograms. If the
+         * instance's transmitted payload cannot store all fields, the trailing fields are omitted and the field count
+         * is reduced accordingly. The latencies are 0 if the corresponding histogram is not attached.
+         *
+         * @note The packet is sent with the scatter-gather SendData() method, so the payload staged in the instance's
+         * transmission buffer is preserved.
+         *
+         * @returns true if the telemetry packet was sent, or false if the instance's maximum transmitted payload size
+         * is too small to store the telemetry packet's header and at least one field.
+         */
+        bool SendTelemetry()
+        {
+            _telemetry_timer = 0;
+            if constexpr (kTelemetryFieldLimit == 0) return false;
+
+            const uint32_t fields[kTelemetryFieldCount] = {
+                millis(),
+                _link_statistics.transmitted_packets,
+                _link_statistics.received_packets,
+                _link_statistics.checksum_errors,
+                _link_statistics.timeout_errors,
+                _link_statistics.framing_errors,
+                _skipped_bytes,
+                _sequence_statistics.missing_packets,
+                _link_statistics.reception_backlog_peak,
+                _link_statistics.largest_received_payload,
+                _link_statistics.largest_transmitted_payload,
+                _reception_histogram != nullptr ? _reception_histogram->GetPercentile(50) : 0,
+                _reception_histogram != nullptr ? _reception_histogram->GetPercentile(99) : 0,
+                _reception_histogram != nullptr ? _reception_histogram->get_maximum() : 0,
+                _transmission_histogram != nullptr ? _transmission_histogram->GetPercentile(50) : 0,
+                _transmission_histogram != nullptr ? _transmission_histogram->GetPercentile(99) : 0,
+                _transmission_histogram != nullptr ? _transmission_histogram->get_maximum() : 0,
+            };
+            const uint8_t header[kTelemetryHeaderSize] = {
+                kReservedPacketTypes::kTelemetry,
+                kTelemetryFormatVersion,
+                kTelemetryFieldLimit,
+                kMaximumTransmittedPayloadSize,
+                kMaximumReceivedPayloadSize,
+                kSequenceNumberSize,
+                kPostambleSize
+            };
+            const DataSegment segments[] = {
+                {header, kTelemetryHeaderSize},
+                {fields, static_cast<uint16_t>(kTelemetryFieldLimit * sizeof(uint32_t))}
+            };
+            return SendData(segments);
+        }
+
+        /**
+         * @brief Configures the instance to send the telemetry packet periodically.
+         *
+         * The telemetry packet is sent by the first ReceiveData() call made after the interval has passed since the
+         * previous telemetry packet was sent. See the SendTelemetry() method for the telemetry packet's layout.
+         *
+         * @param interval The interval, in milliseconds, at which to send the telemetry packet. Setting this to 0
+         * (default) disables the periodic telemetry.
+         */
+        void SetTelemetryInterval(const uint32_t interval)
+        {
+            _telemetry_interval = interval;
+            _telemetry_timer    = 0;
+        }
+
         /**
          * @brief Packages the data inside the instance's transmission buffer into a serialized packet and transmits it
          * over the communication interface.
          *
          * @warning This method resets the instance's transmission buffer after transmitting the data, discarding any
          * data stored inside the buffer.
+         *
+         * @note If the instance uses sequence numbers, each call stamps the packet with the current transmitted
+         * sequence number and advances it by one, wrapping around at the maximum value supported by the sequence
+         * number's width.
          */
         void SendData()
         {
+            const uint32_t start_time = _transmission_histogram != nullptr ? micros() : 0;
+            CountTransmittedPacket(_transmission_buffer[LayoutType::kPayloadSizeIndex]);
             const uint16_t combined_size = ConstructPacket();
-            _port.write(_transmission_buffer, combined_size);
+            _port.write(&_transmission_buffer[LayoutType::kPacketStartIndex], combined_size);
+            if (_transmission_histogram != nullptr) _transmission_histogram->Record(micros() - start_time);
+            _runtime_status = static_cast<uint8_t>(kTransportStatusCodes::kPacketSent);
+            ResetTransmissionBuffer();
+        }
+
+        /**
+         * @brief Gathers the payload from the input memory segments into a serialized packet and transmits it over the
+         * communication interface without copying the payload into the instance's transmission buffer.
+         *
+         * The COBS encoding and the CRC checksum are calculated while the packet is transmitted. The runs of payload
+         * bytes that do not match the delimiter byte value (0 for the default layout) are written to the communication
+         * interface directly from the input segments, and each encoded delimiter byte is written separately. This
+         * avoids the staging copy made by WriteData() for large payloads that already reside in the application's
+         * memory.
+         *
+         * @note This method does not use or modify the instance's transmission buffer, so it is safe to call it while
+         * the transmission buffer stages the payload of another packet. If the instance uses sequence numbers, the
+         * packet is stamped with the current transmitted sequence number, which is then advanced by one.
+         *
+         * @tparam kSegmentCount The number of memory segments that jointly store the payload.
+         * @param segments The memory segments to gather into the payload, in the order of their appearance in the
+         * payload. Segments with a size of 0 are allowed and are ignored.
+         *
+         * @returns true if the packet was transmitted, or false if the combined size of the segments is not a valid
+         * payload size.
+         */
+        template <size_t kSegmentCount>
+        bool SendData(const DataSegment (&segments)[kSegmentCount])
+        {
+            static_assert(kSegmentCount > 0, "SendData requires at least one data segment.");
+            const uint32_t start_time = _transmission_histogram != nullptr ? micros() : 0;
+
+            // Verifies that the combined size of the segments fits into a single packet.
+            uint16_t payload_size = 0;
+            for (size_t i = 0; i < kSegmentCount; i++)
+            {
+                if (segments[i].size > kMaximumTransmittedPayloadSize - payload_size)
+                {
+                    _runtime_status = static_cast<uint8_t>(kTransportStatusCodes::kInvalidGatheredPayloadSize);
+                    return false;
+                }
+                payload_size += segments[i].size;
+            }
+            if (payload_size < LayoutType::kMinimumPayloadSize)
+            {
+                _runtime_status = static_cast<uint8_t>(kTransportStatusCodes::kInvalidGatheredPayloadSize);
+                return false;
+            }
+            CountTransmittedPacket(static_cast<uint8_t>(payload_size));
+
+            // Resolves the sequence number header extension, which is gathered in front of the input segments.
+            uint8_t sequence_number[2] = {
+                static_cast<uint8_t>(_transmitted_sequence_number & 0xFF),
+                static_cast<uint8_t>(_transmitted_sequence_number >> 8)
+            };
+            const DataSegment header {sequence_number, kSequenceNumberSize};
+            if (kSequenceNumberSize > 0)
+            {
+                payload_size += kSequenceNumberSize;
+                _transmitted_sequence_number = (_transmitted_sequence_number + 1) & kSequenceNumberMask;
+            }
+
+            // Delimiter-framed packets store the checksum of the unencoded payload at the end of the payload, so the
+            // checksum is calculated before the payload is encoded and is gathered behind the input segments.
+            uint8_t trailer_bytes[kPostambleSize] = {};
+            const DataSegment trailer {trailer_bytes, LayoutType::kIsDelimiterFramed ? kPostambleSize : 0};
+            if (LayoutType::kIsDelimiterFramed)
+            {
+                PolynomialType payload_checksum = _checksum_engine.UpdateChecksum(
+                    _checksum_engine.get_initial_value(),
+                    sequence_number,
+                    kSequenceNumberSize
+                );
+                for (size_t i = 0; i < kSegmentCount; i++)
+                {
+                    payload_checksum = _checksum_engine.UpdateChecksum(
+                        payload_checksum,
+                        static_cast<const uint8_t*>(segments[i].data),
+                        segments[i].size
+                    );
+                }
+                payload_checksum = _checksum_engine.FinalizeChecksum(payload_checksum);
+                for (uint8_t i = 0; i < kPostambleSize; ++i)
+                {
+                    trailer_bytes[i] = payload_checksum >> 8 * (kPostambleSize - i - 1) & 0xFF;
+                }
+                payload_size += kPostambleSize;
+            }
+
+            // The scan cursor runs ahead of the transmitted data to find the next delimiter byte, which determines the
+            // value of the overhead byte or the encoded value of the current delimiter byte. Since the cursor only
+            // moves forward, each payload byte is scanned exactly once.
+            GatherCursor scan_cursor {};
+            uint16_t next_delimiter =
+                FindNextDelimiter(header, segments, kSegmentCount, trailer, scan_cursor, payload_size);
+
+            // Transmits the preamble and the overhead byte. The overhead byte stores the distance from the overhead
+            // byte to the first delimiter byte (or to the packet delimiter, if the payload does not contain delimiter
+            // bytes). The upper byte of the 2-byte payload size field is always 0. The delimiter-framed packets only
+            // transmit the overhead byte.
+            uint8_t preamble[LayoutType::kPayloadStartIndex] = {};
+            if (LayoutType::kHasStartByte) preamble[LayoutType::kStartByteIndex] = LayoutType::kStartByte;
+            preamble[LayoutType::kPayloadSizeIndex]  = static_cast<uint8_t>(payload_size);
+            preamble[LayoutType::kOverheadByteIndex] = (next_delimiter + 1) ^ LayoutType::kDelimiterByte;
+            _port.write(&preamble[LayoutType::kPacketStartIndex], sizeof(preamble) - LayoutType::kPacketStartIndex);
+            PolynomialType checksum = _checksum_engine.get_initial_value();
+            if (!LayoutType::kIsDelimiterFramed)
+            {
+                checksum = _checksum_engine.UpdateChecksum(checksum, &preamble[LayoutType::kOverheadByteIndex], 1);
+            }
+
+            // Transmits the payload. Each delimiter byte is replaced with the distance to the next delimiter byte (or
+            // to the packet delimiter). The checksum of the encoded bytes is only calculated for the layouts that
+            // transmit the payload size.
+            uint16_t position = 0;
+            for (size_t i = 0; i <= kSegmentCount + 1; i++)
+            {
+                const DataSegment& segment = GetGatheredSegment(i, header, segments, kSegmentCount, trailer);
+                const auto* data           = static_cast<const uint8_t*>(segment.data);
+                uint16_t offset            = 0;
+                while (offset < segment.size)
+                {
+                    // Transmits the run of bytes that precedes the next delimiter byte or the end of the segment.
+                    const uint16_t run_end = min(
+                        static_cast<uint16_t>(segment.size),
+                        static_cast<uint16_t>(offset + next_delimiter - position)
+                    );
+                    if (run_end > offset)
+                    {
+                        _port.write(&data[offset], run_end - offset);
+                        if (!LayoutType::kIsDelimiterFramed)
+                        {
+                            checksum = _checksum_engine.UpdateChecksum(checksum, &data[offset], run_end - offset);
+                        }
+                        position += run_end - offset;
+                        offset = run_end;
+                    }
+
+                    // Encodes and transmits the delimiter byte.
+                    if (offset < segment.size)
+                    {
+                        const uint16_t current_delimiter = next_delimiter;
+                        next_delimiter =
+                            FindNextDelimiter(header, segments, kSegmentCount, trailer, scan_cursor, payload_size);
+                        const auto encoded_value =
+                            static_cast<uint8_t>((next_delimiter - current_delimiter) ^ LayoutType::kDelimiterByte);
+                        _port.write(encoded_value);
+                        if (!LayoutType::kIsDelimiterFramed)
+                        {
+                            checksum = _checksum_engine.UpdateChecksum(checksum, &encoded_value, 1);
+                        }
+                        position++;
+                        offset++;
+                    }
+                }
+            }
+
+            // Transmits the delimiter byte and, for the layouts that transmit the payload size, the CRC checksum
+            // postamble, starting with the most significant byte.
+            uint8_t postamble[kPostambleSize + 1] = {LayoutType::kDelimiterByte};
+            if (LayoutType::kIsDelimiterFramed)
+            {
+                _port.write(postamble, 1);
+            }
+            else
+            {
+                checksum = _checksum_engine.FinalizeChecksum(_checksum_engine.UpdateChecksum(checksum, postamble, 1));
+                for (uint8_t i = 0; i < kPostambleSize; ++i)
+                {
+                    postamble[i + 1] = checksum >> 8 * (kPostambleSize - i - 1) & 0xFF;
+                }
+                _port.write(postamble, sizeof(postamble));
+            }
+            if (_transmission_histogram != nullptr) _transmission_histogram->Record(micros() - start_time);
+
             _runtime_status = static_cast<uint8_t>(kTransportStatusCodes::kPacketSent);
+            return true;
+        }
+
+        /**
+         * @brief Packages the data inside the instance's transmission buffer into a serialized packet and copies it
+         * into the destination buffer instead of transmitting it.
+         *
+         * This method is used to build packets that are transmitted later, potentially multiple times, via the
+         * SendEncodedData() method without re-running the COBS encoding and CRC checksum calculation.
+         *
+         * @warning This method resets the instance's transmission buffer after encoding the data, discarding any data
+         * stored inside the buffer.
+         *
+         * @tparam kDestinationSize The size of the destination buffer, in bytes. Must be at least as large as the
+         * instance's transmission buffer.
+         * @param destination The buffer where to copy the constructed packet.
+         *
+         * @returns the size of the constructed packet, in bytes.
+         */
+        template <size_t kDestinationSize>
+        uint16_t EncodeData(uint8_t (&destination)[kDestinationSize])
+        {
+            static_assert(
+                kDestinationSize >= kTransmissionBufferSize,
+                "Destination buffer size must be at least equal to the instance's transmission buffer size."
+            );
+
+            return EncodeData(destination, kDestinationSize);
+        }
+
+        /**
+         * @brief Packages the data inside the instance's transmission buffer into a serialized packet and copies it
+         * into the destination memory region instead of transmitting it.
+         *
+         * This overload is used to encode packets directly into the regions of larger buffers, such as packet queues.
+         *
+         * @warning This method resets the instance's transmission buffer after encoding the data, discarding any data
+         * stored inside the buffer.
+         *
+         * @param destination The pointer to the memory region where to copy the constructed packet.
+         * @param destination_size The size of the destination memory region, in bytes. Must be at least as large as
+         * the instance's transmission buffer, regardless of the staged payload size.
+         *
+         * @returns the size of the constructed packet, in bytes, or 0 if the destination region is too small. In the
+         * latter case, the staged payload is kept in the transmission buffer.
+         */
+        uint16_t EncodeData(uint8_t* destination, const uint16_t destination_size)
+        {
+            if (destination_size < kTransmissionBufferSize)
+            {
+                _runtime_status = static_cast<uint8_t>(kTransportStatusCodes::kEncodedDataBufferError);
+                return 0;
+            }
+
+            const uint16_t combined_size = ConstructPacket();
+            memcpy(destination, &_transmission_buffer[LayoutType::kPacketStartIndex], combined_size);
+            _runtime_status = static_cast<uint8_t>(kTransportStatusCodes::kPacketEncoded);
             ResetTransmissionBuffer();
+            return combined_size;
+        }
+
+        /**
+         * @brief Transmits the packet previously constructed by the EncodeData() method over the communication
+         * interface.
+         *
+         * @note This method does not modify the instance's transmission buffer, so it is safe to call it while the
+         * transmission buffer stages the payload of another packet.
+         *
+         * @param packet The buffer that stores the constructed packet.
+         * @param packet_size The size of the constructed packet, in bytes.
+         */
+        void SendEncodedData(const uint8_t* packet, const uint16_t packet_size)
+        {
+            _port.write(packet, packet_size);
+            _runtime_status = static_cast<uint8_t>(kTransportStatusCodes::kPacketSent);
+        }
+
+        /**
+         * @brief Transmits as many bytes of the previously constructed packet data as the communication interface can
+         * accept without blocking.
+         *
+         * The input data may contain multiple consecutive packets or the remaining part of a partially transmitted
+         * packet. All transmitted bytes are written with a single call to the communication interface's write() method.
+         *
+         * @note The number of bytes that can be written without blocking is determined via the communication
+         * interface's availableForWrite() method. Interfaces that do not implement this method always report 0 bytes,
+         * so this method cannot transmit any data over them.
+         *
+         * @param data The buffer that stores the constructed packet data.
+         * @param data_size The number of data bytes to transmit.
+         *
+         * @returns the number of transmitted bytes.
+         */
+        uint16_t TrySendEncodedData(const uint8_t* data, const uint16_t data_size)
+        {
+            const int available_space = _port.availableForWrite();
+            uint16_t bytes_written    = 0;
+            if (available_space > 0)
+            {
+                const auto bytes_to_write = static_cast<uint16_t>(
+                    min(static_cast<uint32_t>(data_size), static_cast<uint32_t>(available_space))
+                );
+                bytes_written = _port.write(data, bytes_to_write);
+            }
+
+            if (bytes_written == data_size)
+            {
+                _runtime_status = static_cast<uint8_t>(kTransportStatusCodes::kPacketSent);
+            }
+            else
+            {
+                _runtime_status = static_cast<uint8_t>(kTransportStatusCodes::kEncodedDataPartiallySent);
+            }
+            return bytes_written;
         }
 
         /**
@@ -338,18 +986,90 @@ class TransportLayer final
          */
         bool ReceiveData()
         {
-            if (!Available())
+            // Sends the periodic telemetry packet, if it is due.
+            if (_telemetry_interval != 0 && _telemetry_timer >= _telemetry_interval) SendTelemetry();
+
+            const int available_bytes = BytesAvailable();
+            if (available_bytes < static_cast<int>(kMinimumPacketSize))
             {
                 _runtime_status = static_cast<uint8_t>(kTransportStatusCodes::kNoBytesToParse);
                 return false;
             }
+            if (available_bytes > _link_statistics.reception_backlog_peak)
+            {
+                _link_statistics.reception_backlog_peak =
+                    available_bytes < 0xFFFF ? static_cast<uint16_t>(available_bytes) : 0xFFFF;
+            }
 
             ResetReceptionBuffer();
 
-            if (!ParsePacket()) return false;
+            if (!ParsePacket() || !ValidatePacket())
+            {
+                CountReceptionError();
+                return false;
+            }
 
-            if (!ValidatePacket()) return false;
+            if (kSequenceNumberSize > 0) TrackSequenceNumber();
 
+            if (_reception_histogram != nullptr) _reception_histogram->Record(micros() - _reception_start_time);
+
+            CountReceivedPacket();
+            _runtime_status = static_cast<uint8_t>(kTransportStatusCodes::kPacketReceived);
+            return true;
+        }
+
+        /**
+         * @brief Verifies the integrity of the packet framed outside the instance and decodes its payload into the
+         * instance's reception buffer.
+         *
+         * This method is used by the InterruptReceiver and StreamingReceiver classes, which frame the incoming packets
+         * outside the instance and pass each framed packet to this method from the application's loop.
+         *
+         * @warning Calling this method resets the instance's reception buffer, discarding any unprocessed data.
+         *
+         * @param packet The framed packet bytes, starting with the first payload size byte and ending with the last
+         * postamble byte. The start byte is not included. For delimiter-framed layouts, the packet starts with the COBS
+         * overhead byte and ends with the delimiter byte.
+         * @param packet_size The number of framed packet bytes.
+         * @returns true if the packet was successfully verified and unpacked and false otherwise.
+         */
+        bool ReceiveFramedPacket(const uint8_t* packet, const uint16_t packet_size)
+        {
+            ResetReceptionBuffer();
+
+            // Verifies that the payload size is within the expected range and that the number of framed bytes matches
+            // the payload size. Delimiter-framed packets do not transmit the payload size, so it is derived from the
+            // number of framed bytes instead.
+            constexpr uint16_t kPacketIndex =
+                LayoutType::kIsDelimiterFramed ? LayoutType::kOverheadByteIndex : LayoutType::kPayloadSizeIndex;
+            const uint16_t payload_size =
+                LayoutType::kIsDelimiterFramed ? packet_size - 2 - kPostambleSize
+                                               : (packet_size >= LayoutType::kPayloadSizeWidth ? packet[0] : 0);
+            if (payload_size < LayoutType::kMinimumPayloadSize + kSequenceNumberSize ||
+                payload_size > kMaximumReceivedPayloadSize + kSequenceNumberSize ||
+                (LayoutType::kPayloadSizeWidth > 1 && packet[1] != 0) ||
+                packet_size != payload_size + kFramedPacketOverhead)
+            {
+                _runtime_status = static_cast<uint8_t>(kTransportStatusCodes::kInvalidPayloadSize);
+                CountReceptionError();
+                return false;
+            }
+
+            memcpy(static_cast<void*>(&_reception_buffer[kPacketIndex]), static_cast<const void*>(packet), packet_size);
+            if (LayoutType::kIsDelimiterFramed)
+            {
+                _reception_buffer[LayoutType::kPayloadSizeIndex] = static_cast<uint8_t>(payload_size + kPostambleSize);
+            }
+
+            if (!ValidatePacket())
+            {
+                CountReceptionError();
+                return false;
+            }
+
+            if (kSequenceNumberSize > 0) TrackSequenceNumber();
+
+            CountReceivedPacket();
             _runtime_status = static_cast<uint8_t>(kTransportStatusCodes::kPacketReceived);
             return true;
         }
@@ -369,7 +1089,7 @@ class TransportLayer final
         {
             // Computes the index at which to start writing the input object's bytes based on the size of the payload
             // already stored inside the buffer.
-            const auto start_index = static_cast<uint16_t>(_transmission_buffer[kBufferLayout::kPayloadSizeIndex]);
+            const auto start_index = static_cast<uint16_t>(_transmission_buffer[LayoutType::kPayloadSizeIndex]);
 
             // Calculates the total size of the payload in the transmission buffer including the new bytes to be
             // added to the buffer.
@@ -385,7 +1105,7 @@ class TransportLayer final
             // Shifts the global start index to translate it from payload-centric to buffer-centric. The buffer contains
             // multiple metadata variables not exposed to the user, so any index that is relative to the payload has to
             // be converted to account for the preceding metadata bytes.
-            const uint16_t local_start_index = start_index + kBufferLayout::kPayloadStartIndex;
+            const uint16_t local_start_index = start_index + kDataStartIndex;
 
             memcpy(
                 static_cast<void*>(&_transmission_buffer[local_start_index]),
@@ -394,8 +1114,8 @@ class TransportLayer final
             );
 
             // Updates the payload size tracker to reflect the increased payload size.
-            _transmission_buffer[kBufferLayout::kPayloadSizeIndex] =
-                max(_transmission_buffer[kBufferLayout::kPayloadSizeIndex], static_cast<uint8_t>(payload_size));
+            _transmission_buffer[LayoutType::kPayloadSizeIndex] =
+                max(_transmission_buffer[LayoutType::kPayloadSizeIndex], static_cast<uint8_t>(payload_size));
 
             _runtime_status = static_cast<uint8_t>(kTransportStatusCodes::kObjectWrittenToBuffer);
             return true;
@@ -427,7 +1147,7 @@ class TransportLayer final
             const uint16_t required_size = start_index + object_size;
 
             // Verifies that the reception buffer has enough bytes to accommodate reading the object.
-            if (required_size > _reception_buffer[kBufferLayout::kPayloadSizeIndex])
+            if (required_size > _reception_buffer[LayoutType::kPayloadSizeIndex])
             {
                 _runtime_status = static_cast<uint8_t>(kTransportStatusCodes::kReadObjectBufferError);
                 return false;
@@ -436,7 +1156,7 @@ class TransportLayer final
             // Shifts the input start_index to translate it from payload-centric to buffer-centric. The buffer contains
             // multiple metadata variables not exposed to the user, so any index that is relative to the payload has to
             // be converted to account for the preceding metadata bytes.
-            const uint16_t local_start_index = start_index + kBufferLayout::kPayloadStartIndex;
+            const uint16_t local_start_index = start_index + kDataStartIndex;
 
             memcpy(
                 static_cast<void*>(&object),
@@ -452,26 +1172,73 @@ class TransportLayer final
         }
 
     private:
-        /// The maximum number of microseconds (us) to wait between receiving any two consecutive bytes of the packet
-        /// before declaring the packet stale. This prevents the runtime from getting stuck in the reception cycle.
-        static constexpr uint32_t kTimeout = 10000;  // 10 ms
+        /// The default maximum number of microseconds (us) to wait between receiving any two consecutive bytes of the
+        /// packet before declaring the packet stale. Used when the baud rate of the communication interface is unknown.
+        static constexpr uint32_t kDefaultTimeout = 10000;  // 10 ms
+
+        /// The number of bits transferred for each byte by the UART interfaces using the 8N1 framing.
+        static constexpr uint32_t kBitsPerByte = 10;
+
+        /// The number of byte transfer times added to the inter-byte timeout derived from the baud rate.
+        static constexpr uint32_t kTimeoutSlackBytes = 2;
+
+        /// The fixed margin, in microseconds, added to the timeouts derived from the baud rate. Accounts for the
+        /// scheduling jitter of the sender and the time the receiver spends outside the reception loop.
+        static constexpr uint32_t kTimeoutMargin = 1000;  // 1 ms
+
+        /// Stores the version of the telemetry packet's payload layout. Incremented whenever the layout changes.
+        static constexpr uint8_t kTelemetryFormatVersion = 1;
+
+        /// Stores the size of the telemetry packet's header, in bytes.
+        static constexpr uint8_t kTelemetryHeaderSize = 7;
+
+        /// Stores the number of fields supported by the telemetry packet.
+        static constexpr uint8_t kTelemetryFieldCount = 17;
+
+        /// Stores the number of telemetry fields that fit into the instance's transmitted payload.
+        static constexpr uint8_t kTelemetryFieldLimit =
+            kMaximumTransmittedPayloadSize < kTelemetryHeaderSize + sizeof(uint32_t) ? 0
+            : (kMaximumTransmittedPayloadSize - kTelemetryHeaderSize) / sizeof(uint32_t) < kTelemetryFieldCount
+                ? (kMaximumTransmittedPayloadSize - kTelemetryHeaderSize) / sizeof(uint32_t)
+                : kTelemetryFieldCount;
+
+        /// Stores the maximum number of bytes read from the communication interface at a time when searching for the
+        /// start byte of the incoming packet.
+        static constexpr uint8_t kScanBlockSize = 32;
+
+        /// Stores the index of the first user payload byte inside the staging buffers. The optional sequence number
+        /// header extension precedes the user payload inside the COBS-encoded region of the packet.
+        static constexpr uint8_t kDataStartIndex = LayoutType::kPayloadStartIndex + kSequenceNumberSize;
 
-        /// Stores the size of the CRC checksum postamble, in bytes.
-        static constexpr uint8_t kPostambleSize = sizeof(PolynomialType);  // NOLINT(*-dynamic-static-initializers)
+        /// Stores the bit-mask used to wrap the sequence numbers around at the maximum value supported by their width.
+        static constexpr uint16_t kSequenceNumberMask = kSequenceNumberSize == 2 ? 0xFFFF : 0xFF;
+
+        /// Stores the number of the most recently received sequence numbers tracked to discriminate duplicated and
+        /// reordered packets.
+        static constexpr uint8_t kSequenceWindowSize = 32;
+
+        /// Stores the size of the checksum postamble, in bytes.
+        static constexpr uint8_t kPostambleSize =  // NOLINT(*-dynamic-static-initializers)
+            ChecksumEngineType::kChecksumSize;
+
+        /// Stores the number of framed packet bytes, excluding the start byte, that accompany the payload. This
+        /// includes the payload size field, the COBS overhead and delimiter bytes, and the checksum postamble.
+        static constexpr uint8_t kFramedPacketOverhead =  // NOLINT(*-dynamic-static-initializers)
+            LayoutType::kPayloadSizeWidth + 2 + kPostambleSize;
 
         /// Stores the minimum number of buffered bytes required before the instance attempts to read a packet.
-        static constexpr uint16_t kMinimumPacketSize = kBufferLayout::kMinimumPayloadSize +
-                                                       kBufferLayout::kOverheadByteIndex +
+        static constexpr uint16_t kMinimumPacketSize = LayoutType::kMinimumPayloadSize +
+                                                       LayoutType::kOverheadByteIndex +
                                                        kPostambleSize;  // NOLINT(*-dynamic-static-initializers)
 
         /// Stores the size of the instance's transmission staging buffer, in bytes.
-        static constexpr uint16_t kTransmissionBufferSize = kMaximumTransmittedPayloadSize +
-                                                            kBufferLayout::kOverheadByteIndex + 2 +
+        static constexpr uint16_t kTransmissionBufferSize = kMaximumTransmittedPayloadSize + kSequenceNumberSize +
+                                                            LayoutType::kOverheadByteIndex + 2 +
                                                             kPostambleSize;  // NOLINT(*-dynamic-static-initializers)
 
         /// Stores the size of the instance's reception staging buffer, in bytes.
-        static constexpr uint16_t kReceptionBufferSize = kMaximumReceivedPayloadSize +
-                                                         kBufferLayout::kOverheadByteIndex + 2 +
+        static constexpr uint16_t kReceptionBufferSize = kMaximumReceivedPayloadSize + kSequenceNumberSize +
+                                                         LayoutType::kOverheadByteIndex + 2 +
                                                          kPostambleSize;  // NOLINT(*-dynamic-static-initializers)
 
         // Ensures that the requested transmission buffer does not exceed the microcontroller's serial buffer size.
@@ -499,8 +1266,8 @@ class TransportLayer final
         /// The reference to the Stream class instance that works with the communication interface.
         Stream& _port;
 
-        /// The CRCProcessor instance used to calculate CRC checksums for the incoming and outgoing data packets.
-        CRCProcessor<PolynomialType> _crc_processor;
+        /// The checksum engine instance used to calculate checksums for the incoming and outgoing data packets.
+        ChecksumEngineType _checksum_engine;
 
         /// The buffer that stages the payload data before it is transmitted.
         uint8_t _transmission_buffer[kTransmissionBufferSize];
@@ -514,20 +1281,352 @@ class TransportLayer final
         /// Stores the runtime status of the most recently called method.
         uint8_t _runtime_status = static_cast<uint8_t>(kTransportStatusCodes::kStandby);
 
+        /// Stores the sequence number assigned to the next transmitted packet.
+        uint16_t _transmitted_sequence_number = 0;
+
+        /// Stores the sequence number of the most recently received packet.
+        uint16_t _received_sequence_number = 0;
+
+        /// Stores the highest sequence number received so far, which is used as the reference for gap detection.
+        uint16_t _newest_sequence_number = 0;
+
+        /// Tracks the reception of the kSequenceWindowSize sequence numbers that precede (and include) the newest
+        /// received sequence number. Bit 0 corresponds to the newest sequence number.
+        uint32_t _received_sequence_window = 0;
+
+        /// Determines whether the instance has received the packet used as the reference for sequence tracking.
+        bool _sequence_synchronized = false;
+
+        /// Stores the counters that track the gaps, duplicates, and reordering of the received sequence numbers.
+        SequenceStatistics _sequence_statistics;
+
+        /// Stores the block of bytes read from the communication interface when searching for the start byte. The
+        /// bytes that follow the start byte are retained and consumed before reading new bytes from the interface.
+        uint8_t _scan_buffer[kScanBlockSize] {};
+
+        /// Stores the index of the next unconsumed byte inside the scan buffer.
+        uint8_t _scan_start = 0;
+
+        /// Stores the index one past the last byte stored inside the scan buffer.
+        uint8_t _scan_end = 0;
+
+        /// Tracks the number of bytes discarded while searching for the start byte of the incoming packets.
+        uint32_t _skipped_bytes = 0;
+
+        /// Stores the maximum number of microseconds to wait between receiving any two consecutive bytes of the packet.
+        uint32_t _inter_byte_timeout = kDefaultTimeout;
+
+        /// Stores the number of microseconds it takes to transfer one byte. 0 disables the whole-packet budget.
+        uint32_t _byte_transfer_time = 0;
+
+        /// Stores the pointer to the histogram that records the reception latencies, if one is attached.
+        LatencyHistogram* _reception_histogram = nullptr;
+
+        /// Stores the pointer to the histogram that records the transmission latencies, if one is attached.
+        LatencyHistogram* _transmission_histogram = nullptr;
+
+        /// Stores the time, in microseconds, at which the start byte of the currently received packet was found.
+        uint32_t _reception_start_time = 0;
+
+        /// Tracks the health of the communication link.
+        LinkStatistics _link_statistics;
+
+        /// Stores the interval, in milliseconds, at which the telemetry packet is sent. 0 disables the periodic
+        /// telemetry.
+        uint32_t _telemetry_interval = 0;
+
+        /// Tracks the time elapsed since the previous telemetry packet was sent.
+        elapsedMillis _telemetry_timer = 0;
+
+        /// Tracks the scan position inside the data segments gathered by the scatter-gather SendData() method.
+        struct GatherCursor
+        {
+                size_t segment    = 0;  ///< The index of the scanned segment. Index 0 refers to the sequence header.
+                uint16_t offset   = 0;  ///< The offset of the next scanned byte inside the scanned segment.
+                uint16_t position = 0;  ///< The position of the next scanned byte inside the gathered payload.
+        };
+
+        /// Returns the gathered segment with the input index. Index 0 refers to the sequence number header, and the
+        /// index that follows the last input segment refers to the checksum trailer.
+        static const DataSegment& GetGatheredSegment(
+            const size_t index,
+            const DataSegment& header,
+            const DataSegment* segments,
+            const size_t segment_count,
+            const DataSegment& trailer
+        )
+        {
+            if (index == 0) return header;
+            return index <= segment_count ? segments[index - 1] : trailer;
+        }
+
+        /**
+         * @brief Finds the next byte that matches the delimiter byte value in the gathered payload, starting at the
+         * cursor's position, and advances the cursor past it.
+         *
+         * @param header The segment that stores the sequence number header extension, which precedes all other
+         * segments.
+         * @param segments The gathered payload segments.
+         * @param segment_count The number of gathered payload segments.
+         * @param trailer The segment that stores the checksum trailer of the delimiter-framed packets, which follows
+         * all other segments.
+         * @param cursor The cursor that tracks the scan position.
+         * @param payload_size The combined size of the gathered payload, including the sequence header.
+         *
+         * @returns the position of the found delimiter byte inside the gathered payload, or the payload size if the
+         * payload does not contain any more delimiter bytes.
+         */
+        static uint16_t FindNextDelimiter(
+            const DataSegment& header,
+            const DataSegment* segments,
+            const size_t segment_count,
+            const DataSegment& trailer,
+            GatherCursor& cursor,
+            const uint16_t payload_size
+        )
+        {
+            while (cursor.segment <= segment_count + 1)
+            {
+                const DataSegment& segment =
+                    GetGatheredSegment(cursor.segment, header, segments, segment_count, trailer);
+                const auto* data           = static_cast<const uint8_t*>(segment.data);
+                if (cursor.offset < segment.size)
+                {
+                    const void* delimiter =
+                        memchr(&data[cursor.offset], LayoutType::kDelimiterByte, segment.size - cursor.offset);
+                    if (delimiter != nullptr)
+                    {
+                        const auto delimiter_offset =
+                            static_cast<uint16_t>(static_cast<const uint8_t*>(delimiter) - data);
+                        const uint16_t delimiter_position = cursor.position + delimiter_offset - cursor.offset;
+                        cursor.position                   = delimiter_position + 1;
+                        cursor.offset                     = delimiter_offset + 1;
+                        return delimiter_position;
+                    }
+                    cursor.position += segment.size - cursor.offset;
+                }
+                cursor.segment++;
+                cursor.offset = 0;
+            }
+            return payload_size;
+        }
+
         /**
          * @brief Constructs the serialized packet using the payload stored inside the instance's transmission buffer.
          *
-         * @returns the combined size of the constructed data packet to be transmitted.
+         * @returns the combined size of the constructed data packet to be transmitted. The packet starts at the
+         * layout's packet start index of the transmission buffer.
          */
         uint16_t ConstructPacket()
         {
+            // Stamps the packet with the sequence number header extension, which is placed in front of the user
+            // payload and is included in the payload size.
+            if (kSequenceNumberSize > 0)
+            {
+                _transmission_buffer[LayoutType::kPayloadStartIndex] = _transmitted_sequence_number & 0xFF;
+                if (kSequenceNumberSize > 1)
+                {
+                    _transmission_buffer[LayoutType::kPayloadStartIndex + 1] = _transmitted_sequence_number >> 8;
+                }
+                _transmission_buffer[LayoutType::kPayloadSizeIndex] += kSequenceNumberSize;
+                _transmitted_sequence_number = (_transmitted_sequence_number + 1) & kSequenceNumberMask;
+            }
+
+            // Delimiter-framed packets store the checksum of the unencoded payload at the end of the payload, and the
+            // checksum is COBS-encoded together with the payload.
+            if (LayoutType::kIsDelimiterFramed)
+            {
+                const uint16_t payload_end_index =
+                    LayoutType::kPayloadStartIndex + _transmission_buffer[LayoutType::kPayloadSizeIndex];
+                WriteChecksum(LayoutType::kPayloadStartIndex, payload_end_index);
+                _transmission_buffer[LayoutType::kPayloadSizeIndex] += kPostambleSize;
+                return COBSProcessor::EncodePayload<LayoutType>(_transmission_buffer);
+            }
+
             // Encodes the payload into a transmittable packet in-place using the COBS algorithm.
-            COBSProcessor::EncodePayload(_transmission_buffer);
+            COBSProcessor::EncodePayload<LayoutType>(_transmission_buffer);
 
-            // Calculates the CRC checksum for the encoded packet and writes it to the postamble region.
-            const uint16_t combined_size = _crc_processor.template CalculateChecksum<false>(_transmission_buffer);
+            // Calculates the checksum for the encoded packet and writes it to the postamble region.
+            constexpr uint16_t start_index = LayoutType::kOverheadByteIndex;
+            return WriteChecksum(start_index, start_index + _transmission_buffer[LayoutType::kPayloadSizeIndex] + 2);
+        }
 
-            return combined_size;
+        /**
+         * @brief Calculates the checksum of the transmission buffer's region and writes it immediately after the
+         * region, starting with the most significant byte.
+         *
+         * For the layouts that transmit the payload size, the region spans all bytes between the overhead byte and the
+         * delimiter byte, inclusive. For the delimiter-framed layouts, the region spans the unencoded payload.
+         *
+         * @param start_index The index of the first byte of the region.
+         * @param end_index The index one past the last byte of the region.
+         * @returns the total size of the packet, including the checksum postamble.
+         */
+        uint16_t WriteChecksum(const uint16_t start_index, const uint16_t end_index)
+        {
+            const PolynomialType checksum = _checksum_engine.FinalizeChecksum(
+                _checksum_engine.UpdateChecksum(
+                    _checksum_engine.get_initial_value(),
+                    &_transmission_buffer[start_index],
+                    end_index - start_index
+                )
+            );
+            for (uint8_t i = 0; i < kPostambleSize; ++i)
+            {
+                _transmission_buffer[end_index + i] = checksum >> 8 * (kPostambleSize - i - 1) & 0xFF;
+            }
+            return end_index + kPostambleSize;
+        }
+
+        /**
+         * @brief Calculates the checksum of the reception buffer's region and verifies it against the checksum stored
+         * immediately after the region.
+         *
+         * @param start_index The index of the first byte of the region.
+         * @param end_index The index one past the last byte of the region.
+         * @returns true if the region is intact and false otherwise.
+         */
+        bool VerifyChecksum(const uint16_t start_index, const uint16_t end_index) const
+        {
+            PolynomialType received_checksum = 0;
+            for (uint8_t i = 0; i < kPostambleSize; ++i)
+            {
+                received_checksum = received_checksum << 8 | _reception_buffer[end_index + i];
+            }
+            return _checksum_engine.VerifyChecksum(
+                _checksum_engine.UpdateChecksum(
+                    _checksum_engine.get_initial_value(),
+                    &_reception_buffer[start_index],
+                    end_index - start_index
+                ),
+                received_checksum
+            );
+        }
+
+        /**
+         * @brief Discards the received bytes that precede the start byte of the next packet.
+         *
+         * If the next received byte is the start byte, which is the case for the streams without noise, the method
+         * only consumes that byte. Otherwise, it reads the available bytes from the communication interface in blocks
+         * and uses memchr() to locate the start byte in each block. The bytes that follow the start byte are retained
+         * in the scan buffer and are consumed by the ReadByte() method before any new bytes are read from the
+         * interface.
+         *
+         * @note For layouts without the start byte, the method only verifies that the communication interface has
+         * received data, as any received byte may begin a packet.
+         *
+         * @returns true if the start byte was found and consumed and false if the received data was exhausted without
+         * finding the start byte.
+         */
+        bool FindStartByte()
+        {
+            if (!LayoutType::kHasStartByte) return BytesAvailable() > 0;
+
+            while (true)
+            {
+                // Refills the scan buffer if all previously read bytes were consumed.
+                if (_scan_start == _scan_end)
+                {
+                    const int available_bytes = _port.available();
+                    if (available_bytes <= 0) return false;
+                    if (_port.peek() == LayoutType::kStartByte)
+                    {
+                        _port.read();
+                        return true;
+                    }
+                    _scan_start = 0;
+                    _scan_end   = static_cast<uint8_t>(
+                        _port.readBytes(_scan_buffer, min(static_cast<size_t>(available_bytes), sizeof(_scan_buffer)))
+                    );
+                    if (_scan_end == 0) return false;
+                }
+
+                const auto* start_byte = static_cast<const uint8_t*>(
+                    memchr(&_scan_buffer[_scan_start], LayoutType::kStartByte, _scan_end - _scan_start)
+                );
+                if (start_byte == nullptr)
+                {
+                    _skipped_bytes += _scan_end - _scan_start;
+                    _scan_start = _scan_end;
+                    continue;
+                }
+
+                const auto start_index = static_cast<uint8_t>(start_byte - _scan_buffer);
+                _skipped_bytes += start_index - _scan_start;
+                _scan_start = start_index + 1;
+                return true;
+            }
+        }
+
+        /// Updates the link statistics with the packet whose payload has the input size, in bytes.
+        void CountTransmittedPacket(const uint8_t payload_size)
+        {
+            _link_statistics.transmitted_packets++;
+            if (payload_size > _link_statistics.largest_transmitted_payload)
+            {
+                _link_statistics.largest_transmitted_payload = payload_size;
+            }
+        }
+
+        /// Updates the link statistics with the successfully received packet stored in the reception buffer.
+        void CountReceivedPacket()
+        {
+            _link_statistics.received_packets++;
+            if (_reception_buffer[LayoutType::kPayloadSizeIndex] > _link_statistics.largest_received_payload)
+            {
+                _link_statistics.largest_received_payload = _reception_buffer[LayoutType::kPayloadSizeIndex];
+            }
+        }
+
+        /// Returns the polynomial mismatch reported by the input checksum engine. Selected over the overload below
+        /// if the engine implements the optional has_polynomial_mismatch() method.
+        template <typename EngineType>
+        static auto HasPolynomialMismatch(const EngineType& engine, int) -> decltype(engine.has_polynomial_mismatch())
+        {
+            return engine.has_polynomial_mismatch();
+        }
+
+        /// Returns false for the checksum engines that do not implement the has_polynomial_mismatch() method.
+        template <typename EngineType>
+        static bool HasPolynomialMismatch(const EngineType&, long)
+        {
+            return false;
+        }
+
+        /// Updates the link statistics with the reception error stored in the runtime status.
+        void CountReceptionError()
+        {
+            switch (static_cast<kTransportStatusCodes>(_runtime_status))
+            {
+                case kTransportStatusCodes::kNoBytesToParse: break;
+                case kTransportStatusCodes::kCRCCheckFailed:
+                    _link_statistics.checksum_errors++;
+                    break;
+                case kTransportStatusCodes::kPayloadSizeByteNotFound:
+                case kTransportStatusCodes::kPacketTimeoutError:
+                case kTransportStatusCodes::kPostambleTimeoutError:
+                    _link_statistics.timeout_errors++;
+                    break;
+                default:
+                    _link_statistics.framing_errors++;
+                    break;
+            }
+        }
+
+        /// Returns the number of received bytes that are available for reading, including the bytes retained in the
+        /// scan buffer.
+        [[nodiscard]]
+        int BytesAvailable() const
+        {
+            return _scan_end - _scan_start + _port.available();
+        }
+
+        /// Reads the next received byte, consuming the bytes retained in the scan buffer before reading from the
+        /// communication interface. Must only be called if BytesAvailable() returns a non-zero value.
+        uint8_t ReadByte()
+        {
+            if (_scan_start < _scan_end) return _scan_buffer[_scan_start++];
+            return static_cast<uint8_t>(_port.read());
         }
 
         /**
@@ -539,75 +1638,80 @@ class TransportLayer final
          */
         bool ParsePacket()
         {
+            if (LayoutType::kIsDelimiterFramed) return ParseDelimitedPacket();
+
             // Tracks the number of data bytes read from the transmission interface buffer. Initializes to the size of
             // the preamble, as the preamble is discarded as part of the data reception process.
-            uint16_t bytes_read = kBufferLayout::kOverheadByteIndex;
+            uint16_t bytes_read = LayoutType::kOverheadByteIndex;
 
             // Finds the start byte of the packet. The start byte tells the receiver that the following data belongs
             // to a well-formed packet and should be retained for further processing.
-            bool start_byte_found = false;
-            while (_port.available())
-            {
-                if (_port.read() == kBufferLayout::kStartByte)
-                {
-                    start_byte_found = true;
-                    break;
-                }
-            }
-
-            if (!start_byte_found)
+            if (!FindStartByte())
             {
                 _runtime_status = static_cast<uint8_t>(kTransportStatusCodes::kNoBytesToParse);
                 return false;
             }
+            if (_reception_histogram != nullptr) _reception_start_time = micros();
 
-            // Attempts to read the payload size byte, blocking until timeout is reached or the byte is resolved.
+            // Attempts to read the payload size field, blocking until timeout is reached or all bytes of the field
+            // are resolved. The 2-byte fields are stored in little-endian order.
             elapsedMicros timeout_timer = 0;
-            bool payload_size_found     = false;
-            while (timeout_timer < kTimeout)
+            elapsedMicros packet_timer  = 0;
+            uint8_t size_bytes_read     = 0;
+            while (timeout_timer < _inter_byte_timeout && size_bytes_read < LayoutType::kPayloadSizeWidth)
             {
-                if (_port.available())
+                if (BytesAvailable())
                 {
-                    _reception_buffer[kBufferLayout::kPayloadSizeIndex] = _port.read();
-
-                    // Aborts with an error if the payload size is outside the expected range.
-                    if (_reception_buffer[kBufferLayout::kPayloadSizeIndex] < kBufferLayout::kMinimumPayloadSize ||
-                        _reception_buffer[kBufferLayout::kPayloadSizeIndex] > kMaximumReceivedPayloadSize)
-                    {
-                        _runtime_status = static_cast<uint8_t>(kTransportStatusCodes::kInvalidPayloadSize);
-                        return false;
-                    }
-
-                    payload_size_found = true;
-                    break;
+                    _reception_buffer[LayoutType::kPayloadSizeIndex + size_bytes_read] = ReadByte();
+                    size_bytes_read++;
+                    timeout_timer = 0;
                 }
             }
 
-            if (!payload_size_found)
+            if (size_bytes_read < LayoutType::kPayloadSizeWidth)
             {
                 _runtime_status = static_cast<uint8_t>(kTransportStatusCodes::kPayloadSizeByteNotFound);
                 return false;
             }
 
+            // Aborts with an error if the payload size is outside the expected range. The payload size includes the
+            // sequence number header extension, if it is used. The upper byte of the 2-byte fields must be 0, as COBS
+            // limits the payloads to 254 bytes.
+            const uint8_t payload_size = _reception_buffer[LayoutType::kPayloadSizeIndex];
+            if (payload_size < LayoutType::kMinimumPayloadSize + kSequenceNumberSize ||
+                payload_size > kMaximumReceivedPayloadSize + kSequenceNumberSize ||
+                (LayoutType::kPayloadSizeWidth > 1 && _reception_buffer[LayoutType::kPayloadSizeIndex + 1] != 0))
+            {
+                _runtime_status = static_cast<uint8_t>(kTransportStatusCodes::kInvalidPayloadSize);
+                return false;
+            }
+
             // Calculates the size of the packet's data to be received, in bytes. This is the size of the payload and
             // the COBS overhead and delimiter bytes.
             const uint16_t packet_size =
-                _reception_buffer[kBufferLayout::kPayloadSizeIndex] + kBufferLayout::kOverheadByteIndex + 2;
+                _reception_buffer[LayoutType::kPayloadSizeIndex] + LayoutType::kOverheadByteIndex + 2;
+            const uint16_t postamble_size = packet_size + static_cast<uint16_t>(kPostambleSize);
+
+            // Calculates the time budget for receiving the rest of the packet, measured from the moment the start byte
+            // was found. If the byte transfer time is not known, the budget is effectively unlimited.
+            const uint32_t packet_budget =
+                _byte_transfer_time == 0 ? UINT32_MAX
+                                         : _inter_byte_timeout + _byte_transfer_time * (postamble_size - 1);
 
             // Parses the incoming packet until the timeout (packet reception stales), an unencoded
             // delimiter byte value is encountered, or the payload is fully received.
             bool delimiter_found = false;
             timeout_timer        = 0;
-            while (timeout_timer < kTimeout && bytes_read < packet_size)
+            while (timeout_timer < _inter_byte_timeout && packet_timer < packet_budget && bytes_read < packet_size)
             {
-                if (_port.available())
+                if (BytesAvailable())
                 {
-                    const uint8_t byte_value      = _port.read();
+                    const uint8_t byte_value      = ReadByte();
                     _reception_buffer[bytes_read] = byte_value;
                     bytes_read++;
                     timeout_timer = 0;
 
-                    if (byte_value == kBufferLayout::kDelimiterByte)
+                    if (byte_value == LayoutType::kDelimiterByte)
                     {
                         delimiter_found = true;
                         break;
@@ -615,8 +1719,8 @@ class TransportLayer final
                 }
             }
 
-            // Packet reception stalled (timed out)
-            if (timeout_timer >= kTimeout && bytes_read < packet_size)
+            // Packet reception stalled (timed out) or exceeded the whole-packet budget
+            if (!delimiter_found && bytes_read < packet_size)
             {
                 _runtime_status = static_cast<uint8_t>(kTransportStatusCodes::kPacketTimeoutError);
                 return false;
@@ -637,20 +1741,19 @@ class TransportLayer final
             }
 
             // Parses the CRC postamble. The CRC bytes should be received immediately after the packet delimiter byte.
-            const uint16_t postamble_size = packet_size + static_cast<uint16_t>(kPostambleSize);
-            timeout_timer                 = 0;
-            while (timeout_timer < kTimeout && bytes_read < postamble_size)
+            timeout_timer = 0;
+            while (timeout_timer < _inter_byte_timeout && packet_timer < packet_budget && bytes_read < postamble_size)
             {
-                if (_port.available())
+                if (BytesAvailable())
                 {
-                    _reception_buffer[bytes_read] = _port.read();
+                    _reception_buffer[bytes_read] = ReadByte();
                     bytes_read++;
                     timeout_timer = 0;
                 }
             }
 
-            // Packet reception stalled (timed out)
-            if (timeout_timer >= kTimeout)
+            // Packet reception stalled (timed out) or exceeded the whole-packet budget
+            if (bytes_read < postamble_size)
             {
                 _runtime_status = static_cast<uint8_t>(kTransportStatusCodes::kPostambleTimeoutError);
                 return false;
@@ -660,6 +1763,93 @@ class TransportLayer final
             return true;
         }
 
+        /**
+         * @brief Parses the bytes stored in the reception buffer of the communication interface as a delimiter-framed
+         * packet and stores it in the instance's reception buffer.
+         *
+         * Delimiter-framed packets do not transmit the start byte or the payload size, so this method treats all bytes
+         * received up to and including the next delimiter byte as the packet and derives the payload size from the
+         * number of received bytes.
+         *
+         * @returns true if the packet was successfully parsed into the instance's reception buffer and false
+         * otherwise.
+         */
+        bool ParseDelimitedPacket()
+        {
+            if (!FindStartByte())
+            {
+                _runtime_status = static_cast<uint8_t>(kTransportStatusCodes::kNoBytesToParse);
+                return false;
+            }
+            if (_reception_histogram != nullptr) _reception_start_time = micros();
+
+            // The largest valid packet ends with the delimiter byte that follows the largest encoded payload, sequence
+            // number, and checksum. The smallest valid packet stores the smallest payload.
+            constexpr uint16_t kMaximumPacketEnd = kReceptionBufferSize;
+            constexpr uint16_t kMinimumPacketEnd =
+                LayoutType::kOverheadByteIndex + 2 + LayoutType::kMinimumPayloadSize + kSequenceNumberSize +
+                kPostambleSize;
+
+            // Calculates the time budget for receiving the packet. If the byte transfer time is not known, the budget
+            // is effectively unlimited.
+            const uint32_t packet_budget =
+                _byte_transfer_time == 0
+                    ? UINT32_MAX
+                    : _inter_byte_timeout + _byte_transfer_time * (kMaximumPacketEnd - LayoutType::kOverheadByteIndex);
+
+            // Parses the incoming packet until the timeout (packet reception stales), an unencoded delimiter byte
+            // value is encountered, or the largest valid packet is received without finding the delimiter byte.
+            uint16_t bytes_read         = LayoutType::kOverheadByteIndex;
+            bool delimiter_found        = false;
+            elapsedMicros timeout_timer = 0;
+            elapsedMicros packet_timer  = 0;
+            while (timeout_timer < _inter_byte_timeout && packet_timer < packet_budget &&
+                   bytes_read < kMaximumPacketEnd)
+            {
+                if (BytesAvailable())
+                {
+                    const uint8_t byte_value      = ReadByte();
+                    _reception_buffer[bytes_read] = byte_value;
+                    bytes_read++;
+                    timeout_timer = 0;
+
+                    if (byte_value == LayoutType::kDelimiterByte)
+                    {
+                        delimiter_found = true;
+                        break;
+                    }
+                }
+            }
+
+            // Packet reception stalled (timed out) or exceeded the whole-packet budget
+            if (!delimiter_found && bytes_read < kMaximumPacketEnd)
+            {
+                _runtime_status = static_cast<uint8_t>(kTransportStatusCodes::kPacketTimeoutError);
+                return false;
+            }
+
+            // Delimiter byte was not found (the packet is corrupted or longer than the reception buffer)
+            if (!delimiter_found)
+            {
+                _runtime_status = static_cast<uint8_t>(kTransportStatusCodes::kDelimiterNotFoundError);
+                return false;
+            }
+
+            // The packet is too short to store the smallest payload and its checksum
+            if (bytes_read < kMinimumPacketEnd)
+            {
+                _runtime_status = static_cast<uint8_t>(kTransportStatusCodes::kInvalidPayloadSize);
+                return false;
+            }
+
+            // Stores the encoded payload size, which includes the sequence number and the checksum, in the payload
+            // size tracker.
+            _reception_buffer[LayoutType::kPayloadSizeIndex] =
+                static_cast<uint8_t>(bytes_read - LayoutType::kOverheadByteIndex - 2);
+            _runtime_status = static_cast<uint8_t>(kTransportStatusCodes::kPacketParsed);
+            return true;
+        }
+
         /**
          * @brief Validates the packet parsed by the ParsePacket() method and decodes its payload using the COBS scheme.
          *
@@ -667,15 +1857,38 @@ class TransportLayer final
          */
         bool ValidatePacket()
         {
-            // Verifies the received data's integrity using its CRC checksum.
-            if (_crc_processor.template CalculateChecksum<true>(_reception_buffer) == 0)
+            // Delimiter-framed packets are decoded before their checksum is verified, as the checksum is calculated
+            // over the unencoded payload and is COBS-encoded together with the payload.
+            if (LayoutType::kIsDelimiterFramed)
+            {
+                if (COBSProcessor::DecodePayload<LayoutType>(_reception_buffer) == 0)
+                {
+                    _runtime_status = static_cast<uint8_t>(kTransportStatusCodes::kDecodingFailed);
+                    return false;
+                }
+
+                // Excludes the checksum from the payload size tracker.
+                _reception_buffer[LayoutType::kPayloadSizeIndex] -= kPostambleSize;
+                const uint16_t payload_end_index =
+                    LayoutType::kPayloadStartIndex + _reception_buffer[LayoutType::kPayloadSizeIndex];
+                if (!VerifyChecksum(LayoutType::kPayloadStartIndex, payload_end_index))
+                {
+                    _runtime_status = static_cast<uint8_t>(kTransportStatusCodes::kCRCCheckFailed);
+                    return false;
+                }
+                return true;
+            }
+
+            // Verifies the received data's integrity using its checksum.
+            constexpr uint16_t start_index = LayoutType::kOverheadByteIndex;
+            if (!VerifyChecksum(start_index, start_index + _reception_buffer[LayoutType::kPayloadSizeIndex] + 2))
             {
                 _runtime_status = static_cast<uint8_t>(kTransportStatusCodes::kCRCCheckFailed);
                 return false;
             }
 
             // Decodes the payload from the packet using the COBS algorithm.
-            if (COBSProcessor::DecodePayload(_reception_buffer) == 0)
+            if (COBSProcessor::DecodePayload<LayoutType>(_reception_buffer) == 0)
             {
                 _runtime_status = static_cast<uint8_t>(kTransportStatusCodes::kDecodingFailed);
                 return false;
@@ -683,6 +1896,72 @@ class TransportLayer final
 
             return true;
         }
+
+        /**
+         * @brief Extracts the sequence number from the decoded packet and uses it to update the sequence statistics.
+         *
+         * Sequence numbers that are ahead of the newest received sequence number by less than half of the sequence
+         * number range are treated as new packets, and any skipped sequence numbers are counted as missing. All other
+         * sequence numbers are treated as late arrivals, which are counted as duplicates if they were already received
+         * and as reordered packets otherwise. Reordered packets that fill a previously detected gap are removed from
+         * the missing packet count.
+         *
+         * @note This method also removes the sequence number header extension from the reception buffer's payload size,
+         * so that the payload size tracker only counts the user payload bytes.
+         */
+        void TrackSequenceNumber()
+        {
+            // Reads the little-endian sequence number and excludes it from the payload size tracker.
+            uint16_t sequence_number = _reception_buffer[LayoutType::kPayloadStartIndex];
+            if (kSequenceNumberSize > 1)
+            {
+                sequence_number |= static_cast<uint16_t>(_reception_buffer[LayoutType::kPayloadStartIndex + 1]) << 8;
+            }
+            _reception_buffer[LayoutType::kPayloadSizeIndex] -= kSequenceNumberSize;
+            _received_sequence_number = sequence_number;
+            _sequence_statistics.received_packets++;
+
+            // Uses the first received packet as the tracking reference.
+            if (!_sequence_synchronized)
+            {
+                _newest_sequence_number   = sequence_number;
+                _received_sequence_window = 1;
+                _sequence_synchronized    = true;
+                return;
+            }
+
+            // Computes the wrapped distance from the newest received sequence number to the received sequence number.
+            const uint16_t forward_distance = (sequence_number - _newest_sequence_number) & kSequenceNumberMask;
+
+            // Handles packets that are newer than any previously received packet. These packets are ahead of the newest
+            // received packet by less than half of the sequence number range (128 or 32768).
+            if (forward_distance != 0 && forward_distance <= kSequenceNumberMask >> 1)
+            {
+                _sequence_statistics.missing_packets += forward_distance - 1;
+                _received_sequence_window =
+                    forward_distance < kSequenceWindowSize ? _received_sequence_window << forward_distance | 1 : 1;
+                _newest_sequence_number = sequence_number;
+                return;
+            }
+
+            // Handles late packets. If the packet is within the tracked window, uses the window to determine whether it
+            // is a duplicate or fills a previously detected gap.
+            const uint16_t backward_distance = (_newest_sequence_number - sequence_number) & kSequenceNumberMask;
+            if (backward_distance < kSequenceWindowSize)
+            {
+                const uint32_t sequence_bit = static_cast<uint32_t>(1) << backward_distance;
+                if (_received_sequence_window & sequence_bit)
+                {
+                    _sequence_statistics.duplicate_packets++;
+                    return;
+                }
+
+                _received_sequence_window |= sequence_bit;
+                if (_sequence_statistics.missing_packets > 0) _sequence_statistics.missing_packets--;
+            }
+
+            _sequence_statistics.reordered_packets++;
+        }
 };
 
 #endif  //AXTLMC_TRANSPORT_LAYER_H
@@ -11,8 +11,20 @@
 #include <unity.h>  // C testing framework, not the Unity game engine
 #include "axtlmc_shared_assets.h"
 #include "cobs_processor.h"
+#include "compressed_channel.h"
+#include "compression_processor.h"
 #include "crc_processor.h"
+#include "fletcher_processor.h"
+#include "interrupt_receiver.h"
+#include "latency_histogram.h"
+#include "loopback_stream_mock.h"
+#include "prepared_packet.h"
+#include "reception_queue.h"
+#include "reliable_channel.h"
+#include "spsc_ring.h"
 #include "stream_mock.h"
+#include "streaming_receiver.h"
+#include "transmission_queue.h"
 #include "transport_layer.h"
 
 using namespace axtlmc_shared_assets;
@@ -286,14 +298,500 @@ void test_crc_processor_calculate_checksum()
     TEST_ASSERT_EQUAL_UINT16(10, result);
 
     // Runs the checksum verification function on the packet and the appended CRC checksum postamble.
-    // Ensures that the CRC checker works as expected. This relies on the known property of CRC checksums: if a CRC
-    // computation runs on the data with appended CRC checksum, the resultant value is always 0. The function interprets
-    // this as a '1' result.
+    // Ensures that the CRC checker works as expected. The checker recalculates the packet's checksum and compares it to
+    // the postamble, returning '1' if they match.
     TEST_ASSERT_EQUAL_UINT16(1, crc_processor.CalculateChecksum<true>(test_packet));
 
     // Invalidates the checksum and verifies that the checker function now returns 0 to indicate data corruption.
     test_packet[9] = 11;
     TEST_ASSERT_EQUAL_UINT16(0, crc_processor.CalculateChecksum<true>(test_packet));
+
+    // Verifies that the checker also works for CRC variants with a non-zero final XOR value (CRC-32/ISO-HDLC). For
+    // these variants, running the data with the appended checksum through the CRC computation does not yield 0.
+    uint8_t crc32_packet[12] = {0x00, 0x04, 0x01, 0x02, 0x03, 0x04, 0x05, 0x15, 0x00, 0x00, 0x00, 0x00};
+    CRCProcessor<uint32_t> crc32_processor(0x04C11DB7, 0xFFFFFFFF, 0xFFFFFFFF);
+    TEST_ASSERT_EQUAL_UINT16(12, crc32_processor.CalculateChecksum<false>(crc32_packet));
+    TEST_ASSERT_EQUAL_UINT16(1, crc32_processor.CalculateChecksum<true>(crc32_packet));
+    crc32_packet[5] = 0x06;
+    TEST_ASSERT_EQUAL_UINT16(0, crc32_processor.CalculateChecksum<true>(crc32_packet));
+}
+
+/// Verifies that the CRCProcessor ShiftChecksum() method supports patching the checksum of the modified data.
+template <typename ProcessorType>
+void VerifyChecksumPatching(ProcessorType& crc_processor)
+{
+    using PolynomialType = typename ProcessorType::ChecksumType;
+
+    uint8_t data[200]  = {};
+    uint8_t zeros[200] = {};
+    uint32_t state     = 0xCAFEBABE;
+    for (uint8_t& value : data)
+    {
+        state ^= state << 13;
+        state ^= state >> 17;
+        state ^= state << 5;
+        value = static_cast<uint8_t>(state);
+    }
+
+    // Verifies that shifting the checksum matches processing the same number of zero bytes.
+    const PolynomialType running_checksum = crc_processor.UpdateChecksum(crc_processor.get_initial_value(), data, 10);
+    for (uint16_t zero_bytes = 0; zero_bytes <= 200; zero_bytes += 7)
+    {
+        TEST_ASSERT_TRUE(
+            crc_processor.ShiftChecksum(running_checksum, zero_bytes) ==
+            crc_processor.UpdateChecksum(running_checksum, zeros, zero_bytes)
+        );
+    }
+
+    // Patches several regions of the data and verifies that the patched checksum matches the recalculated checksum.
+    PolynomialType checksum =
+        crc_processor.UpdateChecksum(crc_processor.get_initial_value(), data, sizeof(data)) ^
+        crc_processor.get_final_xor_value();
+    for (uint16_t offset = 0; offset < 200; offset += 23)
+    {
+        const uint16_t size = 1 + offset % 9;
+        if (offset + size > sizeof(data)) break;
+        PolynomialType delta = crc_processor.UpdateChecksum(0, &data[offset], size);
+        for (uint16_t i = 0; i < size; i++) data[offset + i] ^= static_cast<uint8_t>(offset + i + 1);
+        delta ^= crc_processor.UpdateChecksum(0, &data[offset], size);
+        checksum ^= crc_processor.ShiftChecksum(delta, sizeof(data) - offset - size);
+
+        TEST_ASSERT_TRUE(
+            checksum == (crc_processor.UpdateChecksum(crc_processor.get_initial_value(), data, sizeof(data)) ^
+                         crc_processor.get_final_xor_value())
+        );
+    }
+}
+
+/// Verifies the CRCProcessor ShiftChecksum() method for 8-, 16-, and 32-bit polynomials.
+void test_crc_processor_patch_checksum()
+{
+    CRCProcessor<uint8_t> crc8_processor(0x07, 0x00, 0x00);
+    CRCProcessor<uint16_t> crc16_processor(0x1021, 0xFFFF, 0x0000);
+    CRCProcessor<uint32_t> crc32_processor(0x04C11DB7, 0xFFFFFFFF, 0xFFFFFFFF);
+    VerifyChecksumPatching(crc8_processor);
+    VerifyChecksumPatching(crc16_processor);
+    VerifyChecksumPatching(crc32_processor);
+
+    // Verifies that patching also works with the kernels that do not use the 256-entry lookup table.
+    CRCProcessor<uint16_t, CRCNibbleTableKernel<uint16_t>> crc16_nibble_processor(0x1021, 0xFFFF, 0x0000);
+    CRCProcessor<uint32_t, CRCBitwiseKernel<uint32_t>> crc32_bitwise_processor(0x04C11DB7, 0xFFFFFFFF, 0xFFFFFFFF);
+    VerifyChecksumPatching(crc16_nibble_processor);
+    VerifyChecksumPatching(crc32_bitwise_processor);
+}
+
+/// Calculates the checksum of the input data with the input CRCProcessor several times, reports the average time
+/// per calculation via TEST_MESSAGE, and returns the calculated checksum.
+template <typename ProcessorType>
+typename ProcessorType::ChecksumType
+BenchmarkChecksum(const ProcessorType& crc_processor, const uint8_t* data, const uint16_t size, const char* label)
+{
+    constexpr uint16_t kRepetitions = 50;
+    typename ProcessorType::ChecksumType checksum = 0;
+
+    const uint32_t start_time = micros();
+    for (uint16_t i = 0; i < kRepetitions; i++)
+    {
+        checksum = crc_processor.UpdateChecksum(crc_processor.get_initial_value(), data, size);
+    }
+    const uint32_t elapsed_time = micros() - start_time;
+
+    char message[96];
+    snprintf(
+        message,
+        sizeof(message),
+        "%s: %lu us per %u bytes",
+        label,
+        static_cast<unsigned long>(elapsed_time / kRepetitions),
+        size
+    );
+    TEST_MESSAGE(message);
+    return checksum;
+}
+
+/// Verifies that all CRC kernels produce the same checksums and reports the time each kernel takes to process a
+/// maximum-sized packet.
+void test_crc_processor_kernels()
+{
+    uint8_t data[254];
+    for (uint16_t i = 0; i < sizeof(data); i++) data[i] = static_cast<uint8_t>(i * 31 + 7);
+
+    const CRCProcessor<uint8_t> crc8_ram(0x07, 0x00, 0x00);
+    const CRCProcessor<uint8_t, CRCFlashTableKernel<uint8_t, 0x07>> crc8_flash(0x07, 0x00, 0x00);
+    const CRCProcessor<uint8_t, CRCNibbleTableKernel<uint8_t>> crc8_nibble(0x07, 0x00, 0x00);
+    const CRCProcessor<uint8_t, CRCBitwiseKernel<uint8_t>> crc8_bitwise(0x07, 0x00, 0x00);
+    const uint8_t crc8_checksum = BenchmarkChecksum(crc8_ram, data, sizeof(data), "CRC-8 RAM table");
+    TEST_ASSERT_EQUAL_HEX8(crc8_checksum, BenchmarkChecksum(crc8_flash, data, sizeof(data), "CRC-8 flash table"));
+    TEST_ASSERT_EQUAL_HEX8(crc8_checksum, BenchmarkChecksum(crc8_nibble, data, sizeof(data), "CRC-8 nibble table"));
+    TEST_ASSERT_EQUAL_HEX8(crc8_checksum, BenchmarkChecksum(crc8_bitwise, data, sizeof(data), "CRC-8 bitwise"));
+
+    const CRCProcessor<uint16_t> crc16_ram(0x1021, 0xFFFF, 0x0000);
+    const CRCProcessor<uint16_t, CRCFlashTableKernel<uint16_t, 0x1021>> crc16_flash(0x1021, 0xFFFF, 0x0000);
+    const CRCProcessor<uint16_t, CRCNibbleTableKernel<uint16_t>> crc16_nibble(0x1021, 0xFFFF, 0x0000);
+    const CRCProcessor<uint16_t, CRCBitwiseKernel<uint16_t>> crc16_bitwise(0x1021, 0xFFFF, 0x0000);
+    const uint16_t crc16_checksum = BenchmarkChecksum(crc16_ram, data, sizeof(data), "CRC-16 RAM table");
+    TEST_ASSERT_EQUAL_HEX16(crc16_checksum, BenchmarkChecksum(crc16_flash, data, sizeof(data), "CRC-16 flash table"));
+    TEST_ASSERT_EQUAL_HEX16(
+        crc16_checksum,
+        BenchmarkChecksum(crc16_nibble, data, sizeof(data), "CRC-16 nibble table")
+    );
+    TEST_ASSERT_EQUAL_HEX16(crc16_checksum, BenchmarkChecksum(crc16_bitwise, data, sizeof(data), "CRC-16 bitwise"));
+
+    // Verifies the table-less CRC-32 kernels against the standard check value, as the 32-bit RAM table does not fit
+    // into the memory of some tested boards.
+    const CRCProcessor<uint32_t, CRCFlashTableKernel<uint32_t, 0x04C11DB7>> crc32_flash(0x04C11DB7, 0xFFFFFFFF, 0);
+    const CRCProcessor<uint32_t, CRCNibbleTableKernel<uint32_t>> crc32_nibble(0x04C11DB7, 0xFFFFFFFF, 0);
+    const CRCProcessor<uint32_t, CRCBitwiseKernel<uint32_t>> crc32_bitwise(0x04C11DB7, 0xFFFFFFFF, 0);
+    const uint8_t check[] = {'1', '2', '3', '4', '5', '6', '7', '8', '9'};  // The standard CRC check string
+    TEST_ASSERT_EQUAL_HEX32(
+        0xFC891918,  // CRC-32/BZIP2
+        crc32_flash.UpdateChecksum(crc32_flash.get_initial_value(), check, sizeof(check)) ^ 0xFFFFFFFF
+    );
+    const uint32_t crc32_checksum = BenchmarkChecksum(crc32_flash, data, sizeof(data), "CRC-32 flash table");
+    TEST_ASSERT_EQUAL_HEX32(
+        crc32_checksum,
+        BenchmarkChecksum(crc32_nibble, data, sizeof(data), "CRC-32 nibble table")
+    );
+    TEST_ASSERT_EQUAL_HEX32(crc32_checksum, BenchmarkChecksum(crc32_bitwise, data, sizeof(data), "CRC-32 bitwise"));
+
+// The 32-bit RAM table does not fit into the memory of the boards excluded from the CRC-32 table test.
+#if !defined(__AVR_ATmega328P__) && !defined(__AVR_ATmega32U4__) && !defined(__AVR_ATmega2560__) && \
+    !defined(__AVR_ATtiny85__) && !defined(__AVR_ATmega168__) && !defined(__AVR_ATmega1280__) &&    \
+    !defined(__AVR_ATmega8__) && !defined(__AVR_ATmega16U4__) && !defined(__SAMD21G18A__)
+    const CRCProcessor<uint32_t> crc32_ram(0x04C11DB7, 0xFFFFFFFF, 0xFFFFFFFF);
+    TEST_ASSERT_EQUAL_HEX32(crc32_checksum, BenchmarkChecksum(crc32_ram, data, sizeof(data), "CRC-32 RAM table"));
+#endif
+
+    // Verifies that packets sent by a TransportLayer that stores its CRC table in flash are received by a
+    // TransportLayer that stores its CRC table in RAM.
+    StreamMock<> port;
+    TransportLayer<uint16_t, 64, 64, 0, CRCProcessor<uint16_t, CRCFlashTableKernel<uint16_t, 0x1021>>> transmitter(
+        port,
+        0x1021,
+        0xFFFF,
+        0x0000
+    );
+    TransportLayer<uint16_t, 64, 64> receiver(port, 0x1021, 0xFFFF, 0x0000);
+    transmitter.WriteData(data, 64);
+    transmitter.SendData();
+    for (size_t i = 0; i < port.tx_buffer_index; i++) port.rx_buffer[i] = port.tx_buffer[i];
+    TEST_ASSERT_TRUE(receiver.ReceiveData());
+    TEST_ASSERT_EQUAL_UINT8(64, receiver.get_bytes_in_reception_buffer());
+
+    // Verifies that the flash table kernels report the polynomials that do not match their template polynomial.
+    TEST_ASSERT_FALSE(crc16_flash.has_polynomial_mismatch());
+    TEST_ASSERT_FALSE(crc16_ram.has_polynomial_mismatch());
+    TEST_ASSERT_FALSE(transmitter.get_checksum_engine().has_polynomial_mismatch());
+    TEST_ASSERT_EQUAL_UINT8(
+        static_cast<uint8_t>(kTransportStatusCodes::kStandby),
+        TransportLayer<uint16_t>(port, 0x1021).get_runtime_status()
+    );
+    const CRCProcessor<uint16_t, CRCFlashTableKernel<uint16_t, 0x1021>> mismatched_crc16(0x8005, 0xFFFF, 0x0000);
+    TEST_ASSERT_TRUE(mismatched_crc16.has_polynomial_mismatch());
+    TransportLayer<uint16_t, 64, 64, 0, CRCProcessor<uint16_t, CRCFlashTableKernel<uint16_t, 0x1021>>>
+        mismatched_transmitter(port, 0x8005, 0xFFFF, 0x0000);
+    TEST_ASSERT_TRUE(mismatched_transmitter.has_polynomial_mismatch());
+    TEST_ASSERT_EQUAL_UINT8(
+        static_cast<uint8_t>(kTransportStatusCodes::kPolynomialMismatch),
+        mismatched_transmitter.get_runtime_status()
+    );
+
+    // Verifies that the mismatch is still reported after the runtime status is overwritten.
+    mismatched_transmitter.WriteData(data, 8);
+    mismatched_transmitter.SendData();
+    TEST_ASSERT_TRUE(mismatched_transmitter.has_polynomial_mismatch());
+
+    // Verifies that the flash table kernels' template polynomial is used as the default polynomial.
+    TransportLayer<uint16_t, 64, 64, 0, CRCProcessor<uint16_t, CRCFlashTableKernel<uint16_t, 0x1021>>>
+        default_transmitter(port);
+    TEST_ASSERT_FALSE(default_transmitter.has_polynomial_mismatch());
+    TEST_ASSERT_EQUAL_UINT8(
+        static_cast<uint8_t>(kTransportStatusCodes::kStandby),
+        default_transmitter.get_runtime_status()
+    );
+    TEST_ASSERT_FALSE(TransportLayer<uint16_t>(port).has_polynomial_mismatch());
+}
+
+/// Returns the checksum of the standard "123456789" check string calculated by the input CRCProcessor.
+template <typename ProcessorType>
+typename ProcessorType::ChecksumType CalculateCheckValue(const ProcessorType& crc_processor)
+{
+    const uint8_t check[] = {'1', '2', '3', '4', '5', '6', '7', '8', '9'};
+    return crc_processor.UpdateChecksum(crc_processor.get_initial_value(), check, sizeof(check)) ^
+           crc_processor.get_final_xor_value();
+}
+
+/// Verifies the reflected (LSB-first) CRC kernels against the check values of the standard reflected CRC variants.
+void test_crc_processor_reflected()
+{
+    // CRC-8/MAXIM-DOW
+    const CRCProcessor<uint8_t, CRCTableKernel<uint8_t, true>> crc8_ram(0x31, 0x00, 0x00);
+    const CRCProcessor<uint8_t, CRCFlashTableKernel<uint8_t, 0x31, true>> crc8_flash(0x31, 0x00, 0x00);
+    const CRCProcessor<uint8_t, CRCNibbleTableKernel<uint8_t, true>> crc8_nibble(0x31, 0x00, 0x00);
+    const CRCProcessor<uint8_t, CRCBitwiseKernel<uint8_t, true>> crc8_bitwise(0x31, 0x00, 0x00);
+    TEST_ASSERT_EQUAL_HEX8(0xA1, CalculateCheckValue(crc8_ram));
+    TEST_ASSERT_EQUAL_HEX8(0xA1, CalculateCheckValue(crc8_flash));
+    TEST_ASSERT_EQUAL_HEX8(0xA1, CalculateCheckValue(crc8_nibble));
+    TEST_ASSERT_EQUAL_HEX8(0xA1, CalculateCheckValue(crc8_bitwise));
+
+    // CRC-16/MODBUS
+    const CRCProcessor<uint16_t, CRCTableKernel<uint16_t, true>> crc16_ram(0x8005, 0xFFFF, 0x0000);
+    const CRCProcessor<uint16_t, CRCFlashTableKernel<uint16_t, 0x8005, true>> crc16_flash(0x8005, 0xFFFF, 0x0000);
+    const CRCProcessor<uint16_t, CRCNibbleTableKernel<uint16_t, true>> crc16_nibble(0x8005, 0xFFFF, 0x0000);
+    const CRCProcessor<uint16_t, CRCBitwiseKernel<uint16_t, true>> crc16_bitwise(0x8005, 0xFFFF, 0x0000);
+    TEST_ASSERT_EQUAL_HEX16(0x4B37, CalculateCheckValue(crc16_ram));
+    TEST_ASSERT_EQUAL_HEX16(0x4B37, CalculateCheckValue(crc16_flash));
+    TEST_ASSERT_EQUAL_HEX16(0x4B37, CalculateCheckValue(crc16_nibble));
+    TEST_ASSERT_EQUAL_HEX16(0x4B37, CalculateCheckValue(crc16_bitwise));
+
+    // CRC-16/RIELLO uses an asymmetric initial value, which verifies that the initial value is reflected.
+    const CRCProcessor<uint16_t, CRCTableKernel<uint16_t, true>> crc16_riello(0x1021, 0xB2AA, 0x0000);
+    TEST_ASSERT_EQUAL_HEX16(0x63D0, CalculateCheckValue(crc16_riello));
+
+    // CRC-32/ISO-HDLC, used by zlib
+    const CRCProcessor<uint32_t, CRCFlashTableKernel<uint32_t, 0x04C11DB7, true>> crc32_flash(
+        0x04C11DB7,
+        0xFFFFFFFF,
+        0xFFFFFFFF
+    );
+    CRCProcessor<uint32_t, CRCNibbleTableKernel<uint32_t, true>> crc32_nibble(0x04C11DB7, 0xFFFFFFFF, 0xFFFFFFFF);
+    const CRCProcessor<uint32_t, CRCBitwiseKernel<uint32_t, true>> crc32_bitwise(0x04C11DB7, 0xFFFFFFFF, 0xFFFFFFFF);
+    TEST_ASSERT_EQUAL_HEX32(0xCBF43926, CalculateCheckValue(crc32_flash));
+    TEST_ASSERT_EQUAL_HEX32(0xCBF43926, CalculateCheckValue(crc32_nibble));
+    TEST_ASSERT_EQUAL_HEX32(0xCBF43926, CalculateCheckValue(crc32_bitwise));
+
+    // Verifies that patching works for the reflected checksums.
+    CRCProcessor<uint16_t, CRCTableKernel<uint16_t, true>> crc16_patch(0x1021, 0xB2AA, 0x0000);
+    VerifyChecksumPatching(crc16_patch);
+    VerifyChecksumPatching(crc32_nibble);
+
+    // Verifies that the TransportLayer class transmits and receives packets protected by the reflected checksums.
+    StreamMock<> port;
+    TransportLayer<uint16_t, 64, 64, 0, CRCProcessor<uint16_t, CRCTableKernel<uint16_t, true>>> transport_layer(
+        port,
+        0x8005,
+        0xFFFF,
+        0x0000
+    );
+    const uint8_t payload[5] = {1, 0, 2, 3, 0};
+    transport_layer.WriteData(payload);
+    transport_layer.SendData();
+    for (size_t i = 0; i < port.tx_buffer_index; i++) port.rx_buffer[i] = port.tx_buffer[i];
+    TEST_ASSERT_TRUE(transport_layer.ReceiveData());
+    uint8_t received[5] = {};
+    transport_layer.ReadData(received);
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(payload, received, sizeof(payload));
+}
+
+/// Calculates the Fletcher-16 checksum of the input data using a modulo operation for each byte.
+uint16_t CalculateReferenceFletcher(const uint8_t* data, const uint16_t size)
+{
+    uint16_t first_sum  = 0;
+    uint16_t second_sum = 0;
+    for (uint16_t i = 0; i < size; i++)
+    {
+        first_sum  = (first_sum + data[i]) % 255;
+        second_sum = (second_sum + first_sum) % 255;
+    }
+    return second_sum << 8 | first_sum;
+}
+
+/// Corrupts the input number of randomly selected bits in a copy of the input data for the input number of trials and
+/// returns the number of corruptions not detected by the input checksum engine.
+template <typename EngineType>
+uint16_t CountUndetectedErrors(
+    const EngineType& engine,
+    const uint8_t* data,
+    const uint16_t size,
+    const uint8_t flipped_bits,
+    const uint16_t trials
+)
+{
+    const typename EngineType::ChecksumType checksum =
+        engine.FinalizeChecksum(engine.UpdateChecksum(engine.get_initial_value(), data, size));
+
+    uint8_t corrupted[32];
+    uint32_t state      = 0x9E3779B9;
+    uint16_t undetected = 0;
+    for (uint16_t trial = 0; trial < trials; trial++)
+    {
+        memcpy(corrupted, data, size);
+        for (uint8_t bit = 0; bit < flipped_bits; bit++)
+        {
+            state ^= state << 13;
+            state ^= state >> 17;
+            state ^= state << 5;
+            const uint16_t position = state % (size * 8);
+            corrupted[position / 8] ^= static_cast<uint8_t>(1 << position % 8);
+        }
+        if (memcmp(corrupted, data, size) == 0) continue;  // The flipped bits cancelled each other out
+        if (engine.VerifyChecksum(engine.UpdateChecksum(engine.get_initial_value(), corrupted, size), checksum))
+        {
+            undetected++;
+        }
+    }
+    return undetected;
+}
+
+/// Verifies the FletcherProcessor class and compares its cost and error detection rate with the CRCProcessor class.
+void test_fletcher_processor()
+{
+    // Verifies the checksum against the reference values and the reference implementation.
+    const FletcherProcessor fletcher_processor;
+    const uint8_t abc[] = {'a', 'b', 'c', 'd', 'e', 'f', 'g', 'h'};
+    TEST_ASSERT_EQUAL_HEX16(0xC8F0, FletcherProcessor::FinalizeChecksum(FletcherProcessor::UpdateChecksum(0, abc, 5)));
+    TEST_ASSERT_EQUAL_HEX16(0x2057, FletcherProcessor::FinalizeChecksum(FletcherProcessor::UpdateChecksum(0, abc, 6)));
+    TEST_ASSERT_EQUAL_HEX16(0x0627, FletcherProcessor::FinalizeChecksum(FletcherProcessor::UpdateChecksum(0, abc, 8)));
+
+    // Uses 0xFF bytes to maximize the sums and verify that the deferred reduction does not overflow them. Splits the
+    // data at various offsets to verify that the running checksum is carried over between the calls.
+    uint8_t data[254];
+    memset(data, 0xFF, 100);
+    for (uint16_t i = 100; i < sizeof(data); i++) data[i] = static_cast<uint8_t>(i * 31 + 7);
+    const uint16_t reference = CalculateReferenceFletcher(data, sizeof(data));
+    for (uint16_t split = 0; split <= sizeof(data); split += 19)
+    {
+        const uint16_t checksum = fletcher_processor.UpdateChecksum(0, data, split);
+        TEST_ASSERT_EQUAL_HEX16(
+            reference,
+            fletcher_processor.FinalizeChecksum(
+                fletcher_processor.UpdateChecksum(checksum, &data[split], sizeof(data) - split)
+            )
+        );
+    }
+
+    // Compares the time it takes to process a maximum-sized packet.
+    const CRCProcessor<uint8_t> crc8_processor(0x07, 0x00, 0x00);
+    const CRCProcessor<uint16_t> crc16_processor(0x1021, 0xFFFF, 0x0000);
+    BenchmarkChecksum(crc8_processor, data, sizeof(data), "CRC-8 RAM table");
+    BenchmarkChecksum(crc16_processor, data, sizeof(data), "CRC-16 RAM table");
+    BenchmarkChecksum(fletcher_processor, data, sizeof(data), "Fletcher-16");
+
+    // Compares the error detection rates. All checksums detect all single-bit errors, so only the detection rates of
+    // multi-bit errors are reported.
+    char message[96];
+    for (uint8_t flipped_bits = 1; flipped_bits <= 4; flipped_bits++)
+    {
+        const uint16_t crc8_undetected = CountUndetectedErrors(crc8_processor, data, 32, flipped_bits, 1000);
+        const uint16_t crc16_undetected = CountUndetectedErrors(crc16_processor, data, 32, flipped_bits, 1000);
+        const uint16_t fletcher_undetected = CountUndetectedErrors(fletcher_processor, data, 32, flipped_bits, 1000);
+        if (flipped_bits == 1)
+        {
+            TEST_ASSERT_EQUAL_UINT16(0, crc8_undetected);
+            TEST_ASSERT_EQUAL_UINT16(0, crc16_undetected);
+            TEST_ASSERT_EQUAL_UINT16(0, fletcher_undetected);
+            continue;
+        }
+        snprintf(
+            message,
+            sizeof(message),
+            "%u-bit errors undetected per 1000: CRC-8 %u, CRC-16 %u, Fletcher-16 %u",
+            flipped_bits,
+            crc8_undetected,
+            crc16_undetected,
+            fletcher_undetected
+        );
+        TEST_MESSAGE(message);
+    }
+
+    // Verifies that the TransportLayer class transmits and receives packets protected by the Fletcher-16 checksum.
+    StreamMock<> port;
+    TransportLayer<uint16_t, 64, 64, 0, FletcherProcessor> transport_layer(port);
+    const uint8_t payload[5] = {1, 0, 2, 3, 0};
+    transport_layer.WriteData(payload);
+    transport_layer.SendData();
+    for (size_t i = 0; i < port.tx_buffer_index; i++) port.rx_buffer[i] = port.tx_buffer[i];
+    TEST_ASSERT_TRUE(transport_layer.ReceiveData());
+    uint8_t received[5] = {};
+    transport_layer.ReadData(received);
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(payload, received, sizeof(payload));
+
+    // Verifies that corrupted packets are rejected.
+    port.reset();
+    transport_layer.WriteData(payload);
+    transport_layer.SendData();
+    for (size_t i = 0; i < port.tx_buffer_index; i++) port.rx_buffer[i] = port.tx_buffer[i];
+    port.rx_buffer[5] ^= 0x01;
+    TEST_ASSERT_FALSE(transport_layer.ReceiveData());
+    TEST_ASSERT_EQUAL_UINT8(
+        static_cast<uint8_t>(kTransportStatusCodes::kCRCCheckFailed),
+        transport_layer.get_runtime_status()
+    );
+}
+
+/**
+ * @brief Compresses and decompresses the input payload and verifies that the payload is restored and that the
+ * compressed payload uses the expected method.
+ *
+ * @param payload The payload to compress.
+ * @param size The size of the payload, in bytes.
+ * @param method The compression method expected to be selected for the payload.
+ * @returns the size of the compressed payload, including the header byte, in bytes.
+ */
+uint16_t VerifyCompression(const uint8_t* payload, const uint16_t size, const kCompressionMethods method)
+{
+    uint8_t compressed[256];
+    uint8_t decompressed[254];
+    const uint16_t compressed_size = CompressionProcessor::Compress(payload, size, compressed);
+    TEST_ASSERT_LESS_OR_EQUAL_UINT16(size + 1, compressed_size);
+    TEST_ASSERT_EQUAL_UINT8(static_cast<uint8_t>(method), compressed[0] & ~CompressionProcessor::kOddSizeFlag);
+
+    uint16_t decompressed_size = 0;
+    TEST_ASSERT_TRUE(
+        CompressionProcessor::Decompress(compressed, compressed_size, decompressed, size, decompressed_size)
+    );
+    TEST_ASSERT_EQUAL_UINT16(size, decompressed_size);
+    if (size > 0) TEST_ASSERT_EQUAL_UINT8_ARRAY(payload, decompressed, size);
+    return compressed_size;
+}
+
+/// Verifies that the CompressionProcessor class selects the smallest compression method for each payload, restores
+/// the compressed payloads, and rejects the malformed compressed payloads.
+void test_compression_processor()
+{
+    // Verifies that the slowly varying 16-bit samples use the delta method, including the odd-sized payloads.
+    uint8_t payload[253];
+    for (uint8_t i = 0; i < 126; i++)
+    {
+        const auto sample = static_cast<uint16_t>(30000 + i * 3 - (i % 4) * 5);
+        payload[i * 2]     = static_cast<uint8_t>(sample);
+        payload[i * 2 + 1] = static_cast<uint8_t>(sample >> 8);
+    }
+    payload[252] = 0xAB;
+    TEST_ASSERT_EQUAL_UINT16(3 + 125 + 1, VerifyCompression(payload, 252, kCompressionMethods::kDelta));
+    TEST_ASSERT_EQUAL_UINT16(3 + 125 + 2, VerifyCompression(payload, 253, kCompressionMethods::kDelta));
+
+    // Verifies that the long runs of repeated bytes use the run-length method.
+    memset(payload, 0, 200);
+    for (uint8_t i = 200; i < 253; i++) payload[i] = i;
+    TEST_ASSERT_EQUAL_UINT16(1 + 4 + 54, VerifyCompression(payload, 253, kCompressionMethods::kRunLength));
+
+    // Verifies that the incompressible payloads are stored without compression.
+    for (uint8_t i = 0; i < 253; i++) payload[i] = static_cast<uint8_t>(i * 167 + 13);
+    TEST_ASSERT_EQUAL_UINT16(254, VerifyCompression(payload, 253, kCompressionMethods::kNone));
+    VerifyCompression(payload, 1, kCompressionMethods::kNone);
+    VerifyCompression(payload, 0, kCompressionMethods::kNone);
+
+    // Verifies that the malformed payloads and the payloads that do not fit into the destination are rejected.
+    uint8_t decompressed[16];
+    uint16_t size                            = 0;
+    const uint8_t unknown_method[]           = {3, 1, 2};
+    const uint8_t truncated_literals[]       = {1, 4, 1, 2, 3, 4};
+    const uint8_t truncated_run[]            = {1, 200};
+    const uint8_t oversized_run[]            = {1, 255, 7};
+    const uint8_t truncated_varint[]         = {2, 0x80};
+    const uint8_t overlong_varint[]          = {2, 0x80, 0x80, 0x80, 0x01};
+    const uint8_t odd_without_last_byte[]    = {2 | CompressionProcessor::kOddSizeFlag};
+    const uint8_t oversized_uncompressed[18] = {0};
+    TEST_ASSERT_FALSE(CompressionProcessor::Decompress(unknown_method, 3, decompressed, 16, size));
+    TEST_ASSERT_FALSE(CompressionProcessor::Decompress(truncated_literals, 6, decompressed, 16, size));
+    TEST_ASSERT_FALSE(CompressionProcessor::Decompress(truncated_run, 2, decompressed, 16, size));
+    TEST_ASSERT_FALSE(CompressionProcessor::Decompress(oversized_run, 3, decompressed, 16, size));
+    TEST_ASSERT_FALSE(CompressionProcessor::Decompress(truncated_varint, 2, decompressed, 16, size));
+    TEST_ASSERT_FALSE(CompressionProcessor::Decompress(overlong_varint, 5, decompressed, 16, size));
+    TEST_ASSERT_FALSE(CompressionProcessor::Decompress(odd_without_last_byte, 1, decompressed, 16, size));
+    TEST_ASSERT_FALSE(CompressionProcessor::Decompress(oversized_uncompressed, 18, decompressed, 16, size));
+    TEST_ASSERT_FALSE(CompressionProcessor::Decompress(oversized_uncompressed, 0, decompressed, 16, size));
 }
 
 /// Verifies that StreamMock class methods function correctly.
@@ -1010,6 +1508,1633 @@ void test_transport_layer_postamble_timeout_error()
     mock_port.rx_buffer_index = 0;
 }
 
+/// Verifies the sequence number header extension and the sequence statistics tracked by the TransportLayer class.
+void test_transport_layer_sequence_numbers()
+{
+    // Initializes the transmitting and receiving instances. Both use 8-bit sequence numbers.
+    StreamMock<60> tx_port;
+    StreamMock<60> rx_port;
+    TransportLayer<uint8_t, 20, 20, 1> transmitter(tx_port, 0x07, 0x00, 0x00);
+    TransportLayer<uint8_t, 20, 20, 1> receiver(rx_port, 0x07, 0x00, 0x00);
+
+    // Each packet stores a 1-byte payload and is 7 bytes long: START, PAYLOAD_SIZE, OVERHEAD, SEQUENCE, PAYLOAD[1],
+    // DELIMITER, CRC[1].
+    constexpr uint16_t packet_size = 7;
+
+    // Sends 5 packets with sequence numbers 0 through 4. Each packet stores its sequence number as the payload value.
+    for (uint8_t i = 0; i < 5; i++)
+    {
+        transmitter.WriteData(i);
+        transmitter.SendData();
+    }
+    TEST_ASSERT_EQUAL_UINT16(5, transmitter.get_transmitted_sequence_number());
+
+    // Verifies that the sequence number is stored in front of the payload and is counted by the payload size byte.
+    TEST_ASSERT_EQUAL_INT16(129, tx_port.tx_buffer[packet_size * 3]);
+    TEST_ASSERT_EQUAL_INT16(2, tx_port.tx_buffer[packet_size * 3 + 1]);
+    TEST_ASSERT_EQUAL_INT16(3, tx_port.tx_buffer[packet_size * 3 + 3]);
+
+    // Simulates receiving the packets in the following order: 0, 1, 3, 3, 2, 4. This produces a gap (2), a duplicate
+    // (3) and a late packet (2) that fills the gap.
+    const uint8_t reception_order[6] = {0, 1, 3, 3, 2, 4};
+    for (uint8_t i = 0; i < static_cast<uint8_t>(sizeof(reception_order)); i++)
+    {
+        // Note, adjusts the size to account for the fact mock class uses uint16 buffers
+        memcpy(
+            &rx_port.rx_buffer[packet_size * i],
+            &tx_port.tx_buffer[packet_size * reception_order[i]],
+            packet_size * sizeof(rx_port.tx_buffer[0])
+        );
+    }
+
+    // Receives all packets and verifies that the sequence number is excluded from the received payload.
+    uint8_t payload = 0;
+    for (uint8_t i = 0; i < static_cast<uint8_t>(sizeof(reception_order)); i++)
+    {
+        TEST_ASSERT_TRUE(receiver.ReceiveData());
+        TEST_ASSERT_EQUAL_UINT8(1, receiver.get_bytes_in_reception_buffer());
+        TEST_ASSERT_TRUE(receiver.ReadData(payload));
+        TEST_ASSERT_EQUAL_UINT8(reception_order[i], payload);
+        TEST_ASSERT_EQUAL_UINT16(reception_order[i], receiver.get_received_sequence_number());
+
+        // Verifies the state of the statistics after the gap is detected and before it is filled by the late packet.
+        if (i == 3)
+        {
+            TEST_ASSERT_EQUAL_UINT32(1, receiver.get_sequence_statistics().missing_packets);
+            TEST_ASSERT_EQUAL_UINT32(1, receiver.get_sequence_statistics().duplicate_packets);
+        }
+    }
+
+    // Verifies the final state of the sequence statistics.
+    const SequenceStatistics& statistics = receiver.get_sequence_statistics();
+    TEST_ASSERT_EQUAL_UINT32(6, statistics.received_packets);
+    TEST_ASSERT_EQUAL_UINT32(0, statistics.missing_packets);
+    TEST_ASSERT_EQUAL_UINT32(1, statistics.duplicate_packets);
+    TEST_ASSERT_EQUAL_UINT32(1, statistics.reordered_packets);
+
+    // Verifies that resetting the statistics clears all counters.
+    receiver.ResetSequenceStatistics();
+    TEST_ASSERT_EQUAL_UINT32(0, receiver.get_sequence_statistics().received_packets);
+    TEST_ASSERT_EQUAL_UINT32(0, receiver.get_sequence_statistics().duplicate_packets);
+
+    // Verifies the boundary between the new and the late packets. Only the packets with the sequence numbers 127
+    // (the tracking reference after the reset), 254 (ahead by 127, which is less than half of the sequence number
+    // range), and 126 after the wrap-around (ahead of 254 by exactly half of the range) are delivered.
+    for (uint16_t packet_index = 5; packet_index <= 382; packet_index++)
+    {
+        tx_port.reset();
+        transmitter.WriteData(static_cast<uint8_t>(packet_index));
+        transmitter.SendData();
+        if (packet_index != 127 && packet_index != 254 && packet_index != 382) continue;
+
+        rx_port.reset();
+        memcpy(rx_port.rx_buffer, tx_port.tx_buffer, packet_size * sizeof(rx_port.rx_buffer[0]));
+        TEST_ASSERT_TRUE(receiver.ReceiveData());
+        TEST_ASSERT_EQUAL_UINT16(packet_index & 0xFF, receiver.get_received_sequence_number());
+    }
+    TEST_ASSERT_EQUAL_UINT32(126, receiver.get_sequence_statistics().missing_packets);  // 128 through 253.
+    TEST_ASSERT_EQUAL_UINT32(1, receiver.get_sequence_statistics().reordered_packets);  // 126.
+}
+
+/// Appends the data written to the source StreamMock's transmission buffer to the destination StreamMock's reception
+/// buffer, simulating two Stream interfaces wired back-to-back. If drop is true, discards the data instead.
+template <const uint16_t kBufferSize>
+void TransferStreamData(StreamMock<kBufferSize>& source, StreamMock<kBufferSize>& destination, const bool drop = false)
+{
+    if (!drop)
+    {
+        // The first invalid (-1) value of the reception buffer marks the end of the already received data.
+        const size_t start_index = destination.rx_buffer_index + destination.available();
+        for (size_t i = 0; i < source.tx_buffer_index && start_index + i < kBufferSize; i++)
+        {
+            destination.rx_buffer[start_index + i] = source.tx_buffer[i];
+        }
+    }
+    source.flush();
+}
+
+/// Verifies the acknowledged delivery and selective retransmission of packets by the ReliableChannel class.
+void test_reliable_channel_delivery()
+{
+    // Initializes two channels connected via back-to-back StreamMock instances.
+    StreamMock<300> port_a;
+    StreamMock<300> port_b;
+    port_a.reset();
+    port_b.reset();
+    TransportLayer<uint8_t, 20, 20> transport_a(port_a, 0x07, 0x00, 0x00);
+    TransportLayer<uint8_t, 20, 20> transport_b(port_b, 0x07, 0x00, 0x00);
+    ReliableChannel<TransportLayer<uint8_t, 20, 20>, 4> channel_a(transport_a, 5);
+    ReliableChannel<TransportLayer<uint8_t, 20, 20>, 4> channel_b(transport_b, 5);
+
+    // Sends three packets from channel A. The second packet is lost during transmission.
+    for (uint8_t i = 0; i < 3; i++)
+    {
+        const uint32_t value = 1000 + i;
+        TEST_ASSERT_TRUE(channel_a.WriteData(value));
+        TEST_ASSERT_TRUE(channel_a.SendData());
+        TransferStreamData(port_a, port_b, i == 1);
+    }
+    TEST_ASSERT_EQUAL_UINT8(3, channel_a.get_packets_in_flight());
+
+    // Receives the two delivered packets on channel B. Each received packet is acknowledged.
+    uint32_t value = 0;
+    TEST_ASSERT_TRUE(channel_b.ReceiveData());
+    TEST_ASSERT_TRUE(channel_b.ReadData(value));
+    TEST_ASSERT_EQUAL_UINT32(1000, value);
+    TEST_ASSERT_TRUE(channel_b.ReceiveData());
+    TEST_ASSERT_TRUE(channel_b.ReadData(value));
+    TEST_ASSERT_EQUAL_UINT32(1002, value);
+    TEST_ASSERT_FALSE(channel_b.ReceiveData());
+    TransferStreamData(port_b, port_a);
+
+    // Processes both acknowledgements on channel A. The first packet is released from the window, and the third packet
+    // is selectively acknowledged, but stays in the window until the second packet is acknowledged.
+    TEST_ASSERT_FALSE(channel_a.ReceiveData());
+    TEST_ASSERT_EQUAL_UINT8(
+        static_cast<uint8_t>(kReliableChannelStatusCodes::kAcknowledgementReceived),
+        channel_a.get_runtime_status()
+    );
+    TEST_ASSERT_FALSE(channel_a.ReceiveData());
+    TEST_ASSERT_EQUAL_UINT8(2, channel_a.get_packets_in_flight());
+
+    // Verifies that only the unacknowledged packet is retransmitted after the timeout expires.
+    channel_a.Poll();
+    TEST_ASSERT_EQUAL_UINT32(0, channel_a.get_retransmitted_packets());
+    delay(6);
+    channel_a.Poll();
+    TEST_ASSERT_EQUAL_UINT32(1, channel_a.get_retransmitted_packets());
+    TransferStreamData(port_a, port_b);
+
+    // Receives the retransmitted packet and acknowledges it, which releases all remaining packets on channel A.
+    TEST_ASSERT_TRUE(channel_b.ReceiveData());
+    TEST_ASSERT_TRUE(channel_b.ReadData(value));
+    TEST_ASSERT_EQUAL_UINT32(1001, value);
+    TransferStreamData(port_b, port_a);
+    TEST_ASSERT_FALSE(channel_a.ReceiveData());
+    TEST_ASSERT_EQUAL_UINT8(0, channel_a.get_packets_in_flight());
+
+    // Verifies that a duplicated packet is discarded by the receiving channel.
+    TEST_ASSERT_TRUE(channel_a.WriteData(value));
+    TEST_ASSERT_TRUE(channel_a.SendData());
+    uint8_t packet_copy[20];
+    const uint16_t packet_size = static_cast<uint16_t>(port_a.tx_buffer_index);
+    for (uint16_t i = 0; i < packet_size; i++) packet_copy[i] = static_cast<uint8_t>(port_a.tx_buffer[i]);
+    port_a.write(packet_copy, packet_size);
+    TransferStreamData(port_a, port_b);
+    TEST_ASSERT_TRUE(channel_b.ReceiveData());
+    TEST_ASSERT_FALSE(channel_b.ReceiveData());
+    TEST_ASSERT_EQUAL_UINT8(
+        static_cast<uint8_t>(kReliableChannelStatusCodes::kDuplicatePacketReceived),
+        channel_b.get_runtime_status()
+    );
+
+    // Verifies that the channel refuses to send new packets while the retransmission window is full.
+    for (uint8_t i = 0; i < 3; i++)
+    {
+        TEST_ASSERT_TRUE(channel_a.WriteData(i));
+        TEST_ASSERT_TRUE(channel_a.SendData());
+    }
+    TEST_ASSERT_TRUE(channel_a.WriteData(value));
+    TEST_ASSERT_FALSE(channel_a.SendData());
+    TEST_ASSERT_EQUAL_UINT8(
+        static_cast<uint8_t>(kReliableChannelStatusCodes::kRetransmissionWindowFull),
+        channel_a.get_runtime_status()
+    );
+}
+
+/// Verifies the LoopbackStreamPair class and the recovery of the TransportLayer class from line noise.
+void test_loopback_stream_lossy_channel()
+{
+    // Initializes two TransportLayer instances connected through a LoopbackStreamPair.
+    LoopbackStreamPair<512> pair;
+    TransportLayer<uint16_t, 32, 32> transmitter(pair.port_a, 0x1021, 0xFFFF, 0x0000);
+    TransportLayer<uint16_t, 32, 32> receiver(pair.port_b, 0x1021, 0xFFFF, 0x0000);
+
+    // Generates the payload for the packet with the given index. The payload stores the index followed by bytes
+    // derived from it, which allows verifying the integrity of each received payload.
+    uint8_t payload[16];
+    auto fill_payload = [&payload](const uint16_t index)
+    {
+        memcpy(payload, &index, sizeof(index));
+        for (uint8_t j = 2; j < static_cast<uint8_t>(sizeof(payload)); j++) payload[j] = (index * 7 + j * 13) & 0xFF;
+    };
+
+    // Verifies that all packets are delivered intact through a channel without impairments.
+    for (uint16_t i = 0; i < 20; i++)
+    {
+        fill_payload(i);
+        transmitter.WriteData(payload);
+        transmitter.SendData();
+        TEST_ASSERT_TRUE(receiver.ReceiveData());
+        uint8_t received[16];
+        TEST_ASSERT_TRUE(receiver.ReadData(received));
+        TEST_ASSERT_EQUAL_UINT8_ARRAY(payload, received, sizeof(payload));
+    }
+    TEST_ASSERT_EQUAL_UINT32(pair.a_to_b.get_statistics().bytes_written, pair.a_to_b.get_statistics().bytes_delivered);
+
+    // Enables line noise and sends a burst of packets. Every packet that is received must be intact, and most packets
+    // must survive the noise.
+    ChannelImpairments impairments;
+    impairments.drop_probability   = 0.002F;
+    impairments.flip_probability   = 0.002F;
+    impairments.insert_probability = 0.002F;
+    impairments.burst_probability  = 0.0005F;
+    impairments.burst_length       = 8;
+    pair.a_to_b.SetImpairments(impairments, 12345);
+
+    uint16_t received_packets = 0;
+    for (uint16_t i = 0; i < 200; i++)
+    {
+        fill_payload(i);
+        transmitter.WriteData(payload);
+        transmitter.SendData();
+        while (receiver.Available())
+        {
+            if (!receiver.ReceiveData()) continue;
+            uint8_t received[16];
+            uint16_t index = 0;
+            TEST_ASSERT_TRUE(receiver.ReadData(received));
+            memcpy(&index, received, sizeof(index));
+            fill_payload(index);
+            TEST_ASSERT_EQUAL_UINT8_ARRAY(payload, received, sizeof(payload));
+            received_packets++;
+        }
+    }
+    TEST_ASSERT_TRUE(pair.a_to_b.get_statistics().bytes_flipped > 0);
+    TEST_ASSERT_TRUE(received_packets > 150);
+
+    // Verifies that the link fully recovers once the noise stops.
+    pair.a_to_b.SetImpairments(ChannelImpairments {});
+    fill_payload(1000);
+    transmitter.WriteData(payload);
+    transmitter.SendData();
+    bool recovered = false;
+    while (receiver.Available() && !recovered) recovered = receiver.ReceiveData();
+    TEST_ASSERT_TRUE(recovered);
+
+    // Verifies that the simulated baud rate limits the rate at which the bytes arrive at the receiving end.
+    impairments           = ChannelImpairments {};
+    impairments.baud_rate = 115200;  // 11520 bytes per second, or ~87 microseconds per byte.
+    pair.b_to_a.SetImpairments(impairments);
+    const uint8_t test_data[100] = {};
+    pair.port_b.write(test_data, sizeof(test_data));
+    TEST_ASSERT_TRUE(pair.port_a.available() < 100);
+    delay(15);
+    TEST_ASSERT_EQUAL_INT32(100, pair.port_a.available());
+
+    // Verifies that the time the channel spends idle without being polled is not credited to the next burst.
+    delay(15);
+    pair.port_b.write(test_data, sizeof(test_data));
+    TEST_ASSERT_TRUE(pair.port_a.available() < 200);
+    delay(15);
+    TEST_ASSERT_EQUAL_INT32(200, pair.port_a.available());
+
+    // Verifies that the idle time is not credited to the next burst even if the reader does not poll the channel
+    // between the bursts.
+    pair.b_to_a.Clear();
+    pair.port_b.write(test_data, sizeof(test_data));
+    delay(30);
+    pair.port_b.write(test_data, sizeof(test_data));
+    const int32_t available_bytes = pair.port_a.available();
+    TEST_ASSERT_TRUE(available_bytes >= 100 && available_bytes < 200);
+    delay(15);
+    TEST_ASSERT_EQUAL_INT32(200, pair.port_a.available());
+}
+
+/// Verifies the CompactStreamMock class and uses it to stream a large number of packets through the TransportLayer
+/// class.
+void test_compact_stream_mock_stress()
+{
+    CompactStreamMock<64> stream;
+
+    // Verifies that the pushed bytes become available for reading in the same order.
+    const uint8_t test_data[10] = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10};
+    TEST_ASSERT_EQUAL_size_t(10, stream.PushReceptionData(test_data, sizeof(test_data)));
+    TEST_ASSERT_EQUAL_INT32(10, stream.available());
+    TEST_ASSERT_EQUAL_INT32(1, stream.peek());
+    TEST_ASSERT_EQUAL_INT32(1, stream.read());
+
+    // Verifies that an invalid byte stalls reading until it is marked as valid again.
+    stream.SetReceptionByteInvalid(3);
+    TEST_ASSERT_EQUAL_INT32(3, stream.available());
+    uint8_t read_data[10] = {};
+    TEST_ASSERT_EQUAL_size_t(3, stream.readBytes(read_data, sizeof(read_data)));
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(&test_data[1], read_data, 3);
+    TEST_ASSERT_EQUAL_INT32(-1, stream.read());
+    stream.SetReceptionByteInvalid(0, false);
+    TEST_ASSERT_EQUAL_INT32(6, stream.available());
+
+    // Verifies that the reception buffer wraps around its end without losing data.
+    for (uint8_t i = 0; i < 20; i++)
+    {
+        TEST_ASSERT_EQUAL_size_t(10, stream.PushReceptionData(test_data, sizeof(test_data)));
+        TEST_ASSERT_EQUAL_size_t(10, stream.readBytes(read_data, sizeof(read_data)));
+        TEST_ASSERT_EQUAL_UINT8(test_data[4], read_data[0]);
+    }
+
+    // Verifies that the transmitted data is moved into the peer's reception buffer.
+    stream.reset();
+    TEST_ASSERT_EQUAL_size_t(10, stream.write(test_data, sizeof(test_data)));
+    TEST_ASSERT_EQUAL_size_t(10, stream.MoveTransmittedData(stream));
+    TEST_ASSERT_EQUAL_size_t(0, stream.get_transmitted_size());
+    TEST_ASSERT_EQUAL_INT32(10, stream.available());
+
+    // Streams 2000 packets between two TransportLayer instances in batches and verifies every received payload.
+    CompactStreamMock<1024> tx_port;
+    CompactStreamMock<1024> rx_port;
+    TransportLayer<uint16_t, 64, 64> transmitter(tx_port, 0x1021, 0xFFFF, 0x0000);
+    TransportLayer<uint16_t, 64, 64> receiver(rx_port, 0x1021, 0xFFFF, 0x0000);
+    uint32_t payload[8]  = {};
+    uint32_t received[8] = {};
+    uint32_t next_index  = 0;
+    for (uint32_t i = 0; i < 2000; i++)
+    {
+        for (uint8_t j = 0; j < 8; j++) payload[j] = i * 8 + j;
+        transmitter.WriteData(payload);
+        transmitter.SendData();
+
+        // Each packet is 39 bytes long, so a batch of 20 packets fits into the stream buffers.
+        if (i % 20 != 19) continue;
+        tx_port.MoveTransmittedData(rx_port);
+        while (receiver.ReceiveData())
+        {
+            TEST_ASSERT_TRUE(receiver.ReadData(received));
+            TEST_ASSERT_EQUAL_UINT32(next_index * 8, received[0]);
+            TEST_ASSERT_EQUAL_UINT32(next_index * 8 + 7, received[7]);
+            next_index++;
+        }
+    }
+    TEST_ASSERT_EQUAL_UINT32(2000, next_index);
+}
+
+/// Verifies that the CompressedChannel class compresses the sent payloads and restores the received payloads.
+void test_compressed_channel()
+{
+    using TransportType = TransportLayer<uint16_t, 254, 254>;
+    CompactStreamMock<512> port;
+    TransportType transport_layer(port, 0x1021, 0xFFFF, 0x0000);
+    CompressedChannel<TransportType> channel(transport_layer);
+    TEST_ASSERT_EQUAL_UINT8(253, CompressedChannel<TransportType>::get_maximum_transmitted_payload_size());
+
+    // Sends a slowly varying array of 16-bit sensor samples followed by a flag and verifies that the packet is
+    // considerably smaller than the uncompressed payload.
+    uint16_t samples[100];
+    for (uint8_t i = 0; i < 100; i++) samples[i] = static_cast<uint16_t>(2048 + (i % 7) - 3);
+    const uint8_t flag = 1;
+    TEST_ASSERT_TRUE(channel.WriteData(samples));
+    TEST_ASSERT_TRUE(channel.WriteData(flag));
+    TEST_ASSERT_TRUE(channel.SendData());
+    TEST_ASSERT_EQUAL_UINT8(0, channel.get_bytes_in_transmission_buffer());
+    TEST_ASSERT_EQUAL_UINT32(sizeof(samples) + 1, channel.get_uncompressed_bytes());
+    TEST_ASSERT_EQUAL_UINT32(1 + 2 + 99 + 1, channel.get_compressed_bytes());
+
+    char message[96];
+    snprintf(
+        message,
+        sizeof(message),
+        "Compressed %lu payload bytes into %lu packet bytes",
+        static_cast<unsigned long>(channel.get_uncompressed_bytes()),
+        static_cast<unsigned long>(port.get_transmitted_size())
+    );
+    TEST_MESSAGE(message);
+
+    // Receives the packet and verifies that the payload is restored.
+    port.PushReceptionData(port.get_transmitted_data(), port.get_transmitted_size());
+    port.flush();
+    TEST_ASSERT_TRUE(channel.ReceiveData());
+    TEST_ASSERT_EQUAL_UINT8(sizeof(samples) + 1, channel.get_bytes_in_reception_buffer());
+    uint16_t received_samples[100] = {};
+    uint8_t received_flag          = 0;
+    TEST_ASSERT_TRUE(channel.ReadData(received_samples));
+    TEST_ASSERT_TRUE(channel.ReadData(received_flag));
+    TEST_ASSERT_EQUAL_UINT16_ARRAY(samples, received_samples, 100);
+    TEST_ASSERT_EQUAL_UINT8(flag, received_flag);
+    TEST_ASSERT_FALSE(channel.ReadData(received_flag));
+    TEST_ASSERT_EQUAL_UINT8(
+        static_cast<uint8_t>(kCompressedChannelStatusCodes::kReadObjectBufferError),
+        channel.get_runtime_status()
+    );
+
+    // Verifies that the staged payload cannot exceed the space left after the compression header.
+    uint8_t payload[253] = {};
+    TEST_ASSERT_TRUE(channel.WriteData(payload));
+    TEST_ASSERT_FALSE(channel.WriteData(flag));
+    TEST_ASSERT_EQUAL_UINT8(
+        static_cast<uint8_t>(kCompressedChannelStatusCodes::kWriteObjectBufferError),
+        channel.get_runtime_status()
+    );
+
+    // Verifies that the packets that do not use a valid compression format are rejected.
+    const uint8_t invalid_payload[] = {3, 1, 2};
+    transport_layer.WriteData(invalid_payload);
+    transport_layer.SendData();
+    port.PushReceptionData(port.get_transmitted_data(), port.get_transmitted_size());
+    port.flush();
+    TEST_ASSERT_FALSE(channel.ReceiveData());
+    TEST_ASSERT_EQUAL_UINT8(
+        static_cast<uint8_t>(kCompressedChannelStatusCodes::kDecompressionFailed),
+        channel.get_runtime_status()
+    );
+    TEST_ASSERT_EQUAL_UINT8(0, channel.get_bytes_in_reception_buffer());
+}
+
+/// Verifies the functioning of the ReceptionQueue class for both supported overflow policies.
+void test_reception_queue()
+{
+    CompactStreamMock<1024> tx_port;
+    CompactStreamMock<1024> rx_port;
+    TransportLayer<uint8_t, 16, 16> transmitter(tx_port);
+    TransportLayer<uint8_t, 16, 16> receiver(rx_port);
+    ReceptionQueue<TransportLayer<uint8_t, 16, 16>, 4> oldest_queue(receiver);
+    ReceptionQueue<TransportLayer<uint8_t, 16, 16>, 4, kQueueOverflowPolicies::kDropNewest> newest_queue(receiver);
+
+    // Verifies that the queues start empty and that polling without received data does not queue any packets.
+    uint32_t value = 0;
+    TEST_ASSERT_EQUAL_UINT8(0, oldest_queue.Poll());
+    TEST_ASSERT_EQUAL_UINT8(
+        static_cast<uint8_t>(kReceptionQueueStatusCodes::kNoPacketsQueued),
+        oldest_queue.get_runtime_status()
+    );
+    TEST_ASSERT_FALSE(oldest_queue.Pop(value));
+    TEST_ASSERT_EQUAL_UINT8(
+        static_cast<uint8_t>(kReceptionQueueStatusCodes::kQueueEmpty),
+        oldest_queue.get_runtime_status()
+    );
+
+    // Sends a burst of 6 packets. The last packet carries an extra byte to verify the payload size tracking.
+    for (uint32_t i = 1; i <= 6; i++)
+    {
+        transmitter.WriteData(i);
+        if (i == 6) transmitter.WriteData(static_cast<uint8_t>(0xAB));
+        transmitter.SendData();
+    }
+    tx_port.MoveTransmittedData(rx_port);
+
+    // Verifies that the drop-oldest queue keeps the 4 newest packets.
+    TEST_ASSERT_EQUAL_UINT8(6, oldest_queue.Poll());
+    TEST_ASSERT_EQUAL_UINT8(
+        static_cast<uint8_t>(kReceptionQueueStatusCodes::kQueueOverflow),
+        oldest_queue.get_runtime_status()
+    );
+    TEST_ASSERT_EQUAL_UINT8(4, oldest_queue.get_size());
+    TEST_ASSERT_EQUAL_UINT8(4, oldest_queue.get_peak_size());
+    TEST_ASSERT_EQUAL_UINT32(2, oldest_queue.get_overflow_count());
+
+    // Verifies that peeking does not consume the payload and that popping does.
+    TEST_ASSERT_TRUE(oldest_queue.Peek(value));
+    TEST_ASSERT_EQUAL_UINT32(3, value);
+    TEST_ASSERT_EQUAL_UINT8(4, oldest_queue.get_size());
+    for (uint32_t i = 3; i <= 5; i++)
+    {
+        TEST_ASSERT_EQUAL_UINT8(4, oldest_queue.get_front_payload_size());
+        TEST_ASSERT_TRUE(oldest_queue.Pop(value));
+        TEST_ASSERT_EQUAL_UINT32(i, value);
+    }
+
+    // Verifies that reading an object larger than the queued payload fails without removing the payload.
+    uint8_t oversized[6] = {};
+    TEST_ASSERT_EQUAL_UINT8(5, oldest_queue.get_front_payload_size());
+    TEST_ASSERT_FALSE(oldest_queue.Pop(oversized));
+    TEST_ASSERT_EQUAL_UINT8(
+        static_cast<uint8_t>(kReceptionQueueStatusCodes::kReadObjectQueueError),
+        oldest_queue.get_runtime_status()
+    );
+    TEST_ASSERT_TRUE(oldest_queue.Pop(oversized, 5));
+    TEST_ASSERT_EQUAL_UINT8(6, oversized[0]);
+    TEST_ASSERT_EQUAL_UINT8(0xAB, oversized[4]);
+    TEST_ASSERT_EQUAL_UINT8(0, oldest_queue.get_size());
+
+    // Sends another burst of 6 packets and verifies that the drop-newest queue keeps the 4 oldest packets.
+    for (uint32_t i = 1; i <= 6; i++)
+    {
+        transmitter.WriteData(i);
+        transmitter.SendData();
+    }
+    tx_port.MoveTransmittedData(rx_port);
+    TEST_ASSERT_EQUAL_UINT8(4, newest_queue.Poll());
+    TEST_ASSERT_EQUAL_UINT32(2, newest_queue.get_overflow_count());
+    for (uint32_t i = 1; i <= 4; i++)
+    {
+        TEST_ASSERT_TRUE(newest_queue.Pop(value));
+        TEST_ASSERT_EQUAL_UINT32(i, value);
+    }
+
+    // Verifies that resetting the counters and clearing the queue work as expected.
+    newest_queue.ResetCounters();
+    TEST_ASSERT_EQUAL_UINT32(0, newest_queue.get_overflow_count());
+    TEST_ASSERT_EQUAL_UINT8(0, newest_queue.get_peak_size());
+    transmitter.WriteData(value);
+    transmitter.SendData();
+    tx_port.MoveTransmittedData(rx_port);
+    TEST_ASSERT_EQUAL_UINT8(1, newest_queue.Poll());
+    newest_queue.Clear();
+    TEST_ASSERT_FALSE(newest_queue.Pop());
+
+    // Verifies that polling a partially received packet returns without waiting for its remaining bytes and that the
+    // packet is queued once the remaining bytes are received.
+    transmitter.WriteData(value);
+    transmitter.SendData();
+    const size_t packet_size = tx_port.get_transmitted_size();
+    rx_port.PushReceptionData(tx_port.get_transmitted_data(), packet_size - 2);
+    TEST_ASSERT_EQUAL_UINT8(0, newest_queue.Poll());
+    TEST_ASSERT_EQUAL_INT(0, rx_port.available());
+    rx_port.PushReceptionData(&tx_port.get_transmitted_data()[packet_size - 2], 2);
+    TEST_ASSERT_EQUAL_UINT8(1, newest_queue.Poll());
+    TEST_ASSERT_TRUE(newest_queue.Pop(value));
+    TEST_ASSERT_EQUAL_UINT32(4, value);
+}
+
+/// Verifies the functioning of the SpscRing class, including the wrap-around of its free-running indices.
+void test_spsc_ring()
+{
+    SpscRing<uint16_t, 4> ring;
+    TEST_ASSERT_EQUAL_UINT8(4, ring.get_capacity());
+
+    // Verifies that the ring refuses elements once full and returns them in the order they were added.
+    uint16_t value = 0;
+    TEST_ASSERT_FALSE(ring.Pop(value));
+    for (uint16_t i = 0; i < 4; i++) TEST_ASSERT_TRUE(ring.Push(i));
+    TEST_ASSERT_FALSE(ring.Push(4));
+    TEST_ASSERT_NULL(ring.get_write_slot());
+    TEST_ASSERT_EQUAL_UINT8(4, ring.get_size());
+    for (uint16_t i = 0; i < 4; i++)
+    {
+        TEST_ASSERT_TRUE(ring.Pop(value));
+        TEST_ASSERT_EQUAL_UINT16(i, value);
+    }
+    TEST_ASSERT_NULL(ring.get_read_slot());
+
+    // Verifies that the in-place slot access works across multiple wrap-arounds of the 8-bit indices.
+    for (uint16_t i = 0; i < 1000; i++)
+    {
+        uint16_t* write_slot = ring.get_write_slot();
+        TEST_ASSERT_NOT_NULL(write_slot);
+        *write_slot = i;
+        TEST_ASSERT_EQUAL_PTR(write_slot, ring.get_write_slot());
+        ring.CommitWrite();
+        if (i % 3 == 0) TEST_ASSERT_TRUE(ring.Push(static_cast<uint16_t>(i + 10000)));
+
+        const uint16_t* read_slot = ring.get_read_slot();
+        TEST_ASSERT_NOT_NULL(read_slot);
+        TEST_ASSERT_EQUAL_UINT16(i, *read_slot);
+        ring.CommitRead();
+        if (i % 3 == 0)
+        {
+            TEST_ASSERT_TRUE(ring.Pop(value));
+            TEST_ASSERT_EQUAL_UINT16(i + 10000, value);
+        }
+        TEST_ASSERT_EQUAL_UINT8(0, ring.get_size());
+    }
+}
+
+/// Verifies the functioning of the InterruptReceiver class.
+void test_interrupt_receiver()
+{
+    using ReceiverType = TransportLayer<uint16_t, 32, 32>;
+    CompactStreamMock<1024> tx_port;
+    CompactStreamMock<1024> rx_port;
+    ReceiverType transmitter(tx_port, 0x1021, 0xFFFF, 0x0000);
+    ReceiverType receiver(rx_port, 0x1021, 0xFFFF, 0x0000, 1000000);
+    InterruptReceiver<ReceiverType, 4> interrupt_receiver(receiver);
+
+    // Verifies that no packets are available before any bytes are ingested.
+    TEST_ASSERT_FALSE(interrupt_receiver.ReceiveData());
+    TEST_ASSERT_EQUAL_UINT8(
+        static_cast<uint8_t>(kInterruptReceiverStatusCodes::kNoPacketsFramed),
+        interrupt_receiver.get_runtime_status()
+    );
+
+    // Ingests three packets byte by byte, as an interrupt service routine would, with noise before each packet. Each
+    // packet is published as soon as its last byte is ingested.
+    const uint8_t noise[] = {1, 2, 0, 3, 255};
+    for (uint32_t i = 1; i <= 3; i++)
+    {
+        for (const uint8_t byte : noise) interrupt_receiver.IngestByte(byte);
+        tx_port.reset();
+        transmitter.WriteData(i);
+        transmitter.SendData();
+        const uint8_t* packet = tx_port.get_transmitted_data();
+        for (size_t j = 0; j < tx_port.get_transmitted_size(); j++)
+        {
+            TEST_ASSERT_EQUAL_UINT8(i - 1, interrupt_receiver.get_pending_packets());
+            interrupt_receiver.IngestByte(packet[j]);
+        }
+        TEST_ASSERT_EQUAL_UINT8(i, interrupt_receiver.get_pending_packets());
+    }
+
+    // Verifies that the framed packets are decoded in order.
+    uint32_t value = 0;
+    for (uint32_t i = 1; i <= 3; i++)
+    {
+        TEST_ASSERT_TRUE(interrupt_receiver.ReceiveData());
+        TEST_ASSERT_EQUAL_UINT8(
+            static_cast<uint8_t>(kInterruptReceiverStatusCodes::kPacketReceived),
+            interrupt_receiver.get_runtime_status()
+        );
+        TEST_ASSERT_TRUE(receiver.ReadData(value));
+        TEST_ASSERT_EQUAL_UINT32(i, value);
+    }
+    TEST_ASSERT_EQUAL_UINT32(3, interrupt_receiver.get_framed_packets());
+    TEST_ASSERT_EQUAL_UINT32(0, interrupt_receiver.get_framing_errors());
+
+    // Verifies that the packets that do not fit into the queue are dropped when ingested from a Stream, as the
+    // serialEvent() callback would.
+    tx_port.reset();
+    for (uint32_t i = 1; i <= 6; i++)
+    {
+        transmitter.WriteData(i);
+        transmitter.SendData();
+    }
+    const auto stream_size = static_cast<uint16_t>(tx_port.get_transmitted_size());
+    tx_port.MoveTransmittedData(rx_port);
+    TEST_ASSERT_EQUAL_UINT16(stream_size, interrupt_receiver.Ingest(rx_port));
+    TEST_ASSERT_EQUAL_UINT8(4, interrupt_receiver.get_pending_packets());
+    TEST_ASSERT_EQUAL_UINT32(2, interrupt_receiver.get_dropped_packets());
+    for (uint32_t i = 1; i <= 4; i++)
+    {
+        TEST_ASSERT_TRUE(interrupt_receiver.ReceiveData());
+        TEST_ASSERT_TRUE(receiver.ReadData(value));
+        TEST_ASSERT_EQUAL_UINT32(i, value);
+    }
+
+    // Verifies that a corrupted packet is framed but rejected by the TransportLayer instance.
+    tx_port.reset();
+    transmitter.WriteData(value);
+    transmitter.SendData();
+    uint8_t packet[16];
+    const size_t packet_size = tx_port.get_transmitted_size();
+    memcpy(packet, tx_port.get_transmitted_data(), packet_size);
+    packet[4] ^= 0x10;
+    for (size_t j = 0; j < packet_size; j++) interrupt_receiver.IngestByte(packet[j]);
+    TEST_ASSERT_FALSE(interrupt_receiver.ReceiveData());
+    TEST_ASSERT_EQUAL_UINT8(
+        static_cast<uint8_t>(kInterruptReceiverStatusCodes::kPacketRejected),
+        interrupt_receiver.get_runtime_status()
+    );
+    TEST_ASSERT_EQUAL_UINT8(
+        static_cast<uint8_t>(kTransportStatusCodes::kCRCCheckFailed),
+        receiver.get_runtime_status()
+    );
+
+    // Verifies that a packet with a misplaced delimiter byte is abandoned without being published.
+    const uint8_t truncated[] = {kBufferLayout::kStartByte, 4, 2, 7, 0, 1};
+    for (const uint8_t byte : truncated) interrupt_receiver.IngestByte(byte);
+    TEST_ASSERT_EQUAL_UINT32(1, interrupt_receiver.get_framing_errors());
+    TEST_ASSERT_EQUAL_UINT8(0, interrupt_receiver.get_pending_packets());
+
+    // Verifies that a stalled packet is abandoned once the inter-byte timeout expires, and that the following packet
+    // is framed correctly.
+    memcpy(packet, tx_port.get_transmitted_data(), packet_size);
+    for (size_t j = 0; j < packet_size / 2; j++) interrupt_receiver.IngestByte(packet[j]);
+    delayMicroseconds(receiver.get_inter_byte_timeout() + 1000);
+    for (size_t j = 0; j < packet_size; j++) interrupt_receiver.IngestByte(packet[j]);
+    TEST_ASSERT_EQUAL_UINT32(2, interrupt_receiver.get_framing_errors());
+    TEST_ASSERT_TRUE(interrupt_receiver.ReceiveData());
+    TEST_ASSERT_TRUE(receiver.ReadData(value));
+    TEST_ASSERT_EQUAL_UINT32(4, value);
+}
+
+/**
+ * @brief Verifies that the StreamingReceiver class frames the packets that use the input layout regardless of how the
+ * received bytes are split into chunks.
+ *
+ * @tparam LayoutType The PacketLayout used by the tested TransportLayer instances.
+ */
+template <typename LayoutType>
+void VerifyStreamingReceiver()
+{
+    using TransportType = TransportLayer<uint16_t, 48, 48, 1, CRCProcessor<uint16_t>, LayoutType>;
+    CompactStreamMock<256> port;
+    TransportType transmitter(port, 0x1021, 0xFFFF, 0x0000);
+    TransportType receiver(port, 0x1021, 0xFFFF, 0x0000);
+    StreamingReceiver<TransportType> streaming_receiver(receiver);
+
+    // Serializes the noise that ends with the delimiter byte followed by multiple packets whose payloads contain the
+    // start and delimiter byte values.
+    constexpr uint8_t kPacketCount = 6;
+    uint8_t stream[512]            = {0x33, 0x44, LayoutType::kDelimiterByte};
+    size_t stream_size             = 3;
+    uint8_t payload[48];
+    for (uint8_t i = 0; i < kPacketCount; i++)
+    {
+        const uint8_t payload_size = 1 + i * 9;
+        for (uint8_t j = 0; j < payload_size; j++)
+        {
+            payload[j] = j % 5 == 0 ? LayoutType::kDelimiterByte : static_cast<uint8_t>(i + j * 3);
+        }
+        payload[payload_size - 1] = LayoutType::kStartByte;
+        transmitter.WriteData(payload, payload_size);
+        transmitter.SendData();
+        memcpy(&stream[stream_size], port.get_transmitted_data(), port.get_transmitted_size());
+        stream_size += port.get_transmitted_size();
+        port.flush();
+    }
+
+    // Feeds the stream in chunks of varying sizes, alternating between copying the chunks and writing them directly
+    // into the accumulation buffer.
+    uint8_t received_packets = 0;
+    uint8_t rejected_packets = 0;
+    for (size_t offset = 0, chunk = 0; offset < stream_size; chunk++)
+    {
+        const auto chunk_size = static_cast<uint16_t>(min(static_cast<size_t>(1 + chunk % 7), stream_size - offset));
+        if (chunk % 2 == 0)
+        {
+            TEST_ASSERT_EQUAL_UINT16(chunk_size, streaming_receiver.Ingest(&stream[offset], chunk_size));
+        }
+        else
+        {
+            memcpy(streaming_receiver.get_write_buffer(), &stream[offset], chunk_size);
+            streaming_receiver.CommitWrite(chunk_size);
+        }
+        offset += chunk_size;
+
+        while (true)
+        {
+            if (streaming_receiver.ReceiveData())
+            {
+                const uint8_t payload_size = 1 + received_packets * 9;
+                TEST_ASSERT_EQUAL_UINT8(payload_size, receiver.get_bytes_in_reception_buffer());
+                TEST_ASSERT_TRUE(receiver.ReadData(payload, payload_size));
+                TEST_ASSERT_EQUAL_UINT8(LayoutType::kStartByte, payload[payload_size - 1]);
+                received_packets++;
+                continue;
+            }
+            if (streaming_receiver.get_runtime_status() ==
+                static_cast<uint8_t>(kStreamingReceiverStatusCodes::kNoPacketsFramed))
+            {
+                break;
+            }
+            rejected_packets++;
+        }
+    }
+    TEST_ASSERT_EQUAL_UINT8(kPacketCount, received_packets);
+    TEST_ASSERT_EQUAL_UINT8(LayoutType::kHasStartByte ? 0 : 1, rejected_packets);  // The noise.
+    TEST_ASSERT_EQUAL_UINT16(0, streaming_receiver.get_buffered_bytes());
+
+    // Verifies that the bytes are read from the communication interface in bulk. If possible, the payload size is
+    // chosen so that the payload size field (which includes the sequence number) stores the delimiter byte value.
+    constexpr uint8_t kPayloadSize =
+        LayoutType::kDelimiterByte > 1 && LayoutType::kDelimiterByte <= 49 ? LayoutType::kDelimiterByte - 1 : 1;
+    transmitter.WriteData(payload, kPayloadSize);
+    transmitter.SendData();
+    port.PushReceptionData(port.get_transmitted_data(), port.get_transmitted_size());
+    TEST_ASSERT_EQUAL_UINT16(port.get_transmitted_size(), streaming_receiver.Ingest(port));
+    TEST_ASSERT_TRUE(streaming_receiver.ReceiveData());
+    TEST_ASSERT_EQUAL_UINT8(kPayloadSize, receiver.get_bytes_in_reception_buffer());
+
+    // Verifies that the accumulated bytes are discarded if they fill the buffer without completing a packet. The
+    // buffer starts with a valid payload size, so the incomplete packet is not rejected before the buffer fills.
+    const uint16_t free_space = streaming_receiver.get_free_space();
+    uint8_t* write_buffer     = streaming_receiver.get_write_buffer();
+    memset(write_buffer, 0x55, free_space);
+    if (LayoutType::kHasStartByte) write_buffer[0] = LayoutType::kStartByte;
+    if (!LayoutType::kIsDelimiterFramed) write_buffer[LayoutType::kPayloadSizeIndex] = 10;
+    if (LayoutType::kPayloadSizeWidth > 1) write_buffer[LayoutType::kPayloadSizeIndex + 1] = 0;
+    streaming_receiver.CommitWrite(free_space);
+    TEST_ASSERT_FALSE(streaming_receiver.ReceiveData());
+    TEST_ASSERT_EQUAL_UINT8(
+        static_cast<uint8_t>(kStreamingReceiverStatusCodes::kBufferOverflow),
+        streaming_receiver.get_runtime_status()
+    );
+    TEST_ASSERT_EQUAL_UINT16(0, streaming_receiver.get_buffered_bytes());
+}
+
+/// Verifies the functioning of the StreamingReceiver class with the default, the alternative, and the
+/// delimiter-framed packet layouts.
+void test_streaming_receiver()
+{
+    VerifyStreamingReceiver<kBufferLayout>();
+    VerifyStreamingReceiver<PacketLayout<129, 0, false>>();    // No start byte.
+    VerifyStreamingReceiver<PacketLayout<129, 0, true, 2>>();  // 2-byte payload size field.
+    VerifyStreamingReceiver<PacketLayout<0x7E, 0x04>>();       // Non-zero delimiter byte.
+    VerifyStreamingReceiver<kDelimitedLayout>();
+}
+
+/// Verifies the functioning of the TransmissionQueue class.
+void test_transmission_queue()
+{
+    CompactStreamMock<64> tx_port;
+    CompactStreamMock<1024> rx_port;
+    TransportLayer<uint8_t, 16, 16> transmitter(tx_port);
+    TransportLayer<uint8_t, 16, 16> receiver(rx_port);
+    TransmissionQueue<TransportLayer<uint8_t, 16, 16>, 128> queue(transmitter);
+
+    // Verifies that the pointer-based EncodeData() overload refuses destination regions that may be too small.
+    uint8_t small_buffer[8] = {};
+    TEST_ASSERT_TRUE(transmitter.WriteData(static_cast<uint8_t>(1)));
+    TEST_ASSERT_EQUAL_UINT16(0, transmitter.EncodeData(small_buffer, sizeof(small_buffer)));
+    TEST_ASSERT_EQUAL_UINT8(
+        static_cast<uint8_t>(kTransportStatusCodes::kEncodedDataBufferError),
+        transmitter.get_runtime_status()
+    );
+    TEST_ASSERT_EQUAL_UINT8(1, transmitter.get_bytes_in_transmission_buffer());
+    transmitter.ResetTransmissionBuffer();
+
+    // Queues 5 packets. Each packet uses 9 bytes: 3 preamble bytes, 4 payload bytes, the delimiter, and the CRC.
+    for (uint32_t i = 0; i < 5; i++)
+    {
+        TEST_ASSERT_TRUE(queue.WriteData(i));
+        TEST_ASSERT_TRUE(queue.SendData());
+    }
+    TEST_ASSERT_EQUAL_UINT16(45, queue.get_queued_bytes());
+    TEST_ASSERT_EQUAL_size_t(0, tx_port.get_transmitted_size());
+
+    // Verifies that all queued packets are transmitted with a single write() call.
+    TEST_ASSERT_EQUAL_UINT16(45, queue.Poll());
+    TEST_ASSERT_EQUAL_UINT8(
+        static_cast<uint8_t>(kTransmissionQueueStatusCodes::kQueueDrained),
+        queue.get_runtime_status()
+    );
+    TEST_ASSERT_EQUAL_UINT32(1, queue.get_write_calls());
+    TEST_ASSERT_EQUAL_UINT16(0, queue.get_queued_bytes());
+
+    // Queues 5 more packets. The interface can only accept 19 more bytes, so the queue is partially drained, and then
+    // stalls until the interface's transmission buffer is emptied.
+    for (uint32_t i = 5; i < 10; i++)
+    {
+        TEST_ASSERT_TRUE(queue.WriteData(i));
+        TEST_ASSERT_TRUE(queue.SendData());
+    }
+    TEST_ASSERT_EQUAL_UINT16(19, queue.Poll());
+    TEST_ASSERT_EQUAL_UINT8(
+        static_cast<uint8_t>(kTransmissionQueueStatusCodes::kPartiallyDrained),
+        queue.get_runtime_status()
+    );
+    TEST_ASSERT_EQUAL_UINT16(0, queue.Poll());
+    TEST_ASSERT_EQUAL_UINT8(
+        static_cast<uint8_t>(kTransmissionQueueStatusCodes::kInterfaceBusy),
+        queue.get_runtime_status()
+    );
+    tx_port.MoveTransmittedData(rx_port);
+    TEST_ASSERT_EQUAL_UINT16(26, queue.Poll());
+    tx_port.MoveTransmittedData(rx_port);
+    TEST_ASSERT_EQUAL_UINT32(10, queue.get_queued_packets());
+
+    // Verifies that all packets are received intact and in order, including the packet split between two writes.
+    uint32_t value = 0;
+    for (uint32_t i = 0; i < 10; i++)
+    {
+        TEST_ASSERT_TRUE(receiver.ReceiveData());
+        TEST_ASSERT_TRUE(receiver.ReadData(value));
+        TEST_ASSERT_EQUAL_UINT32(i, value);
+    }
+
+    // Fills the queue and verifies that the staged payload is kept when the queue runs out of space.
+    bool queue_full = false;
+    for (uint8_t i = 0; i < 20 && !queue_full; i++)
+    {
+        TEST_ASSERT_TRUE(queue.WriteData(static_cast<uint32_t>(i)));
+        queue_full = !queue.SendData();
+    }
+    TEST_ASSERT_TRUE(queue_full);
+    TEST_ASSERT_EQUAL_UINT8(
+        static_cast<uint8_t>(kTransmissionQueueStatusCodes::kQueueFull),
+        queue.get_runtime_status()
+    );
+    TEST_ASSERT_EQUAL_UINT8(4, transmitter.get_bytes_in_transmission_buffer());
+
+    // Verifies that draining part of the queue frees the space for the staged packet.
+    queue.Poll();
+    TEST_ASSERT_TRUE(queue.SendData());
+    queue.Clear();
+    TEST_ASSERT_EQUAL_UINT16(0, queue.get_queued_bytes());
+}
+
+/// Verifies that the scatter-gather SendData() method transmits the same packets as the buffered SendData() method.
+void test_transport_layer_gather_transmission()
+{
+    CompactStreamMock<2048> staged_port;
+    CompactStreamMock<2048> gather_port;
+    TransportLayer<uint16_t, 253, 253, 1> staged_transmitter(staged_port, 0x1021, 0xFFFF, 0x0000);
+    TransportLayer<uint16_t, 253, 253, 1> gather_transmitter(gather_port, 0x1021, 0xFFFF, 0x0000);
+
+    // Generates the segments that include zero bytes at the segment boundaries, in consecutive positions, and in the
+    // middle of the segments, as well as an empty segment and a segment without zero bytes.
+    uint8_t first[6]   = {0, 1, 2, 0, 0, 3};
+    uint8_t second[4]  = {4, 5, 6, 0};
+    uint8_t third[200] = {};
+    for (uint8_t i = 0; i < 200; i++) third[i] = static_cast<uint8_t>(i + 1);
+    uint8_t fourth[40] = {};
+    fourth[10]         = 7;
+
+    // Sends the same payload using both methods and verifies that the transmitted packets are identical. Repeats the
+    // process with the payloads of varying sizes to verify the COBS encoding for the runs that cross the segment
+    // boundaries. The gathered packets are accumulated in the transmission buffer to be received later.
+    size_t gather_offset = 0;
+    for (uint16_t fourth_size = 0; fourth_size <= 40; fourth_size += 10)
+    {
+        const DataSegment segments[5] = {
+            {first, sizeof(first)},
+            {second, sizeof(second)},
+            {nullptr, 0},
+            {third, sizeof(third)},
+            {fourth, fourth_size}
+        };
+        staged_transmitter.WriteData(first);
+        staged_transmitter.WriteData(second);
+        staged_transmitter.WriteData(third);
+        if (fourth_size > 0) staged_transmitter.WriteData(fourth, fourth_size);
+        staged_transmitter.SendData();
+        TEST_ASSERT_TRUE(gather_transmitter.SendData(segments));
+        TEST_ASSERT_EQUAL_UINT8(
+            static_cast<uint8_t>(kTransportStatusCodes::kPacketSent),
+            gather_transmitter.get_runtime_status()
+        );
+        const size_t gathered_size = gather_port.get_transmitted_size() - gather_offset;
+        TEST_ASSERT_EQUAL_size_t(staged_port.get_transmitted_size(), gathered_size);
+        TEST_ASSERT_EQUAL_UINT8_ARRAY(
+            staged_port.get_transmitted_data(),
+            &gather_port.get_transmitted_data()[gather_offset],
+            staged_port.get_transmitted_size()
+        );
+        gather_offset = gather_port.get_transmitted_size();
+        staged_port.flush();
+    }
+
+    // Verifies that the gathered packets are received intact.
+    TransportLayer<uint16_t, 253, 253, 1> receiver(staged_port, 0x1021, 0xFFFF, 0x0000);
+    gather_port.MoveTransmittedData(staged_port);
+    uint8_t received[254] = {};
+    for (uint8_t i = 0; i < 5; i++)
+    {
+        TEST_ASSERT_TRUE(receiver.ReceiveData());
+        TEST_ASSERT_EQUAL_UINT8(i, receiver.get_received_sequence_number());
+        TEST_ASSERT_EQUAL_UINT8(210 + i * 10, receiver.get_bytes_in_reception_buffer());
+        TEST_ASSERT_TRUE(receiver.ReadData(received, receiver.get_bytes_in_reception_buffer()));
+        TEST_ASSERT_EQUAL_UINT8_ARRAY(first, received, sizeof(first));
+        TEST_ASSERT_EQUAL_UINT8_ARRAY(third, &received[10], sizeof(third));
+    }
+
+    // Verifies that the method refuses the segments whose combined size is not a valid payload size.
+    const DataSegment empty_segments[1]     = {{nullptr, 0}};
+    const DataSegment oversized_segments[2] = {{third, 200}, {third, 54}};
+    TEST_ASSERT_FALSE(gather_transmitter.SendData(empty_segments));
+    TEST_ASSERT_EQUAL_UINT8(
+        static_cast<uint8_t>(kTransportStatusCodes::kInvalidGatheredPayloadSize),
+        gather_transmitter.get_runtime_status()
+    );
+    TEST_ASSERT_FALSE(gather_transmitter.SendData(oversized_segments));
+    TEST_ASSERT_EQUAL_size_t(0, gather_port.get_transmitted_size());
+}
+
+/// Verifies that the TransportLayer class skips the noise that precedes the incoming packets and retains the bytes read
+/// together with the noise for the following packets.
+void test_transport_layer_start_byte_search()
+{
+    CompactStreamMock<1024> transmitter_port;
+    CompactStreamMock<1024> receiver_port;
+    TransportLayer<uint8_t, 64, 64> transmitter(transmitter_port);
+    TransportLayer<uint8_t, 64, 64> receiver(receiver_port);
+
+    // Generates the noise that does not contain the start byte.
+    uint8_t noise[100];
+    for (uint8_t i = 0; i < sizeof(noise); i++) noise[i] = static_cast<uint8_t>(i * 7 % 128 + 1);
+
+    // Sends two back-to-back packets that follow 100 noise bytes, and a third packet that follows 5 noise bytes.
+    uint8_t payloads[3][20];
+    for (uint8_t i = 0; i < 3; i++)
+    {
+        for (uint8_t j = 0; j < sizeof(payloads[i]); j++) payloads[i][j] = static_cast<uint8_t>(i * 20 + j);
+        if (i != 1) receiver_port.PushReceptionData(noise, i == 0 ? sizeof(noise) : 5);
+        transmitter.WriteData(payloads[i]);
+        transmitter.SendData();
+        transmitter_port.MoveTransmittedData(receiver_port);
+    }
+
+    // Verifies that all packets are received and that all noise bytes are counted as skipped.
+    for (const auto& payload : payloads)
+    {
+        TEST_ASSERT_TRUE(receiver.Available());
+        TEST_ASSERT_TRUE(receiver.ReceiveData());
+        uint8_t received[20] = {};
+        receiver.ReadData(received);
+        TEST_ASSERT_EQUAL_UINT8_ARRAY(payload, received, sizeof(received));
+    }
+    TEST_ASSERT_FALSE(receiver.Available());
+    TEST_ASSERT_EQUAL_UINT32(105, receiver.get_skipped_bytes());
+
+    // Verifies that the noise without the start byte is fully consumed and counted.
+    receiver_port.PushReceptionData(noise, sizeof(noise));
+    TEST_ASSERT_FALSE(receiver.ReceiveData());
+    TEST_ASSERT_EQUAL_UINT8(
+        static_cast<uint8_t>(kTransportStatusCodes::kNoBytesToParse),
+        receiver.get_runtime_status()
+    );
+    TEST_ASSERT_EQUAL_UINT32(205, receiver.get_skipped_bytes());
+    TEST_ASSERT_EQUAL_INT(0, receiver_port.available());
+
+    receiver.ResetSkippedBytes();
+    TEST_ASSERT_EQUAL_UINT32(0, receiver.get_skipped_bytes());
+}
+
+/// Verifies that the TransportLayer class derives the reception timeouts from the baud rate and abandons stalled and
+/// overly slow packets as early as these timeouts allow.
+void test_transport_layer_reception_timeouts()
+{
+    // Verifies the timeouts derived from the baud rate passed to the constructor and set at runtime.
+    CompactStreamMock<256> transmitter_port;
+    CompactStreamMock<256> receiver_port;
+    TransportLayer<uint8_t, 64, 64> transmitter(transmitter_port);
+    TransportLayer<uint8_t, 64, 64> receiver(receiver_port, 0x07, 0x00, 0x00, 115200);
+    TEST_ASSERT_EQUAL_UINT32(87, receiver.get_byte_transfer_time());
+    TEST_ASSERT_EQUAL_UINT32(1174, receiver.get_inter_byte_timeout());
+    receiver.SetBaudRate(5250000);
+    TEST_ASSERT_EQUAL_UINT32(2, receiver.get_byte_transfer_time());
+    TEST_ASSERT_EQUAL_UINT32(1004, receiver.get_inter_byte_timeout());
+    receiver.SetTimeouts(500, 10);
+    TEST_ASSERT_EQUAL_UINT32(10, receiver.get_byte_transfer_time());
+    TEST_ASSERT_EQUAL_UINT32(500, receiver.get_inter_byte_timeout());
+    receiver.SetBaudRate(0);
+    TEST_ASSERT_EQUAL_UINT32(0, receiver.get_byte_transfer_time());
+    TEST_ASSERT_EQUAL_UINT32(10000, receiver.get_inter_byte_timeout());
+
+    // Verifies that a packet that stalls halfway is abandoned after the derived inter-byte timeout instead of the
+    // default 10 ms timeout.
+    receiver.SetBaudRate(1000000);
+    uint8_t payload[20];
+    for (uint8_t i = 0; i < sizeof(payload); i++) payload[i] = static_cast<uint8_t>(i + 1);
+    transmitter.WriteData(payload);
+    transmitter.SendData();
+    receiver_port.PushReceptionData(transmitter_port.get_transmitted_data(), 10);
+    const uint32_t start = micros();
+    TEST_ASSERT_FALSE(receiver.ReceiveData());
+    const uint32_t elapsed = micros() - start;
+    TEST_ASSERT_EQUAL_UINT8(
+        static_cast<uint8_t>(kTransportStatusCodes::kPacketTimeoutError),
+        receiver.get_runtime_status()
+    );
+    TEST_ASSERT_GREATER_OR_EQUAL_UINT32(receiver.get_inter_byte_timeout(), elapsed);
+    TEST_ASSERT_LESS_THAN_UINT32(10000, elapsed);
+
+    // Verifies that a packet transferred slower than the configured baud rate is abandoned once it exceeds the
+    // whole-packet budget, even though the gaps between its bytes never exceed the inter-byte timeout.
+    LoopbackStreamPair<256> pair;
+    ChannelImpairments impairments;
+    impairments.baud_rate = 9600;
+    pair.a_to_b.SetImpairments(impairments);
+    TransportLayer<uint8_t, 64, 64> slow_transmitter(pair.port_a);
+    TransportLayer<uint8_t, 64, 64> slow_receiver(pair.port_b);
+    slow_receiver.SetTimeouts(2000, 10);
+
+    // Waits for the start byte of the packet to arrive before checking the reception outcome.
+    auto receive_packet = [&slow_receiver]()
+    {
+        const elapsedMillis timer = 0;
+        bool received             = false;
+        while (timer < 100)
+        {
+            received = slow_receiver.ReceiveData();
+            if (slow_receiver.get_runtime_status() != static_cast<uint8_t>(kTransportStatusCodes::kNoBytesToParse))
+            {
+                break;
+            }
+        }
+        return received;
+    };
+
+    slow_transmitter.WriteData(payload);
+    slow_transmitter.SendData();
+    TEST_ASSERT_FALSE(receive_packet());
+    TEST_ASSERT_EQUAL_UINT8(
+        static_cast<uint8_t>(kTransportStatusCodes::kPacketTimeoutError),
+        slow_receiver.get_runtime_status()
+    );
+
+    // Verifies that the same packet is received when the timeouts match the simulated baud rate.
+    delay(50);
+    while (pair.port_b.available()) static_cast<void>(pair.port_b.read());
+    slow_receiver.SetBaudRate(9600);
+    slow_transmitter.WriteData(payload);
+    slow_transmitter.SendData();
+    TEST_ASSERT_TRUE(receive_packet());
+    uint8_t received[20] = {};
+    slow_receiver.ReadData(received);
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(payload, received, sizeof(received));
+}
+
+/// Sends a payload that contains the input layout's delimiter and start byte values and verifies that the staged and
+/// the scatter-gather SendData() methods construct identical packets that only contain the delimiter byte value at the
+/// end of the COBS frame, and that the packets are received intact by the TransportLayer and InterruptReceiver classes.
+template <typename LayoutType>
+void VerifyPacketLayout()
+{
+    using LayoutTransport = TransportLayer<uint16_t, 48, 48, 1, CRCProcessor<uint16_t>, LayoutType>;
+    CompactStreamMock<256> tx_port;
+    CompactStreamMock<256> gather_port;
+    CompactStreamMock<256> rx_port;
+    LayoutTransport transmitter(tx_port, 0x1021, 0xFFFF, 0x0000);
+    LayoutTransport gather_transmitter(gather_port, 0x1021, 0xFFFF, 0x0000);
+    LayoutTransport receiver(rx_port, 0x1021, 0xFFFF, 0x0000);
+
+    const uint8_t special_values[3] = {LayoutType::kDelimiterByte, 0, LayoutType::kStartByte};
+    uint8_t payload[40]             = {};
+    for (uint8_t i = 0; i < 40; i++) payload[i] = i % 4 < 3 ? special_values[i % 4] : i;
+
+    // Verifies that both transmission methods construct the same packet.
+    transmitter.WriteData(payload);
+    transmitter.SendData();
+    const DataSegment segments[2] = {{payload, 21}, {&payload[21], 19}};
+    TEST_ASSERT_TRUE(gather_transmitter.SendData(segments));
+    const size_t packet_size = tx_port.get_transmitted_size();
+    TEST_ASSERT_EQUAL_size_t(packet_size, gather_port.get_transmitted_size());
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(tx_port.get_transmitted_data(), gather_port.get_transmitted_data(), packet_size);
+
+    // Verifies the packet's layout. The payload size includes the 1-byte sequence number.
+    const uint8_t* packet          = tx_port.get_transmitted_data();
+    const uint16_t delimiter_index = LayoutType::kPayloadStartIndex + 41;
+    TEST_ASSERT_EQUAL_size_t(delimiter_index + 3, packet_size);
+    if (LayoutType::kHasStartByte) TEST_ASSERT_EQUAL_UINT8(LayoutType::kStartByte, packet[0]);
+    TEST_ASSERT_EQUAL_UINT8(41, packet[LayoutType::kPayloadSizeIndex]);
+    if (LayoutType::kPayloadSizeWidth > 1) TEST_ASSERT_EQUAL_UINT8(0, packet[LayoutType::kPayloadSizeIndex + 1]);
+    for (uint16_t i = LayoutType::kOverheadByteIndex; i < delimiter_index; i++)
+    {
+        TEST_ASSERT_NOT_EQUAL(LayoutType::kDelimiterByte, packet[i]);
+    }
+    TEST_ASSERT_EQUAL_UINT8(LayoutType::kDelimiterByte, packet[delimiter_index]);
+
+    // Verifies the checksum and decodes the payload directly with the processors specialized for the layout.
+    uint8_t buffer[64] = {};
+    memcpy(buffer, packet, packet_size);
+    CRCProcessor<uint16_t> crc_processor(0x1021, 0xFFFF, 0x0000);
+    TEST_ASSERT_EQUAL_UINT16(1, (crc_processor.CalculateChecksum<true, LayoutType>(buffer)));
+    TEST_ASSERT_EQUAL_UINT16(41, COBSProcessor::DecodePayload<LayoutType>(buffer));
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(payload, &buffer[LayoutType::kPayloadStartIndex + 1], sizeof(payload));
+
+    // Verifies that the packets are received by the TransportLayer class, both when polled and when framed by the
+    // InterruptReceiver class.
+    uint8_t received[40] = {};
+    rx_port.PushReceptionData(packet, packet_size);
+    TEST_ASSERT_TRUE(receiver.ReceiveData());
+    TEST_ASSERT_TRUE(receiver.ReadData(received));
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(payload, received, sizeof(payload));
+
+    InterruptReceiver<LayoutTransport, 2> interrupt_receiver(receiver);
+    for (size_t i = 0; i < packet_size; i++) interrupt_receiver.IngestByte(packet[i]);
+    TEST_ASSERT_TRUE(interrupt_receiver.ReceiveData());
+    memset(received, 0, sizeof(received));
+    TEST_ASSERT_TRUE(receiver.ReadData(received));
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(payload, received, sizeof(payload));
+
+    // Verifies that patching the prepared packet with the delimiter byte values matches the packet constructed from
+    // scratch.
+    PreparedPacket<LayoutTransport> prepared_packet(transmitter);
+    prepared_packet.WriteData(payload);
+    prepared_packet.Prepare();
+    const uint8_t patch[3] = {LayoutType::kDelimiterByte, 7, LayoutType::kDelimiterByte};
+    TEST_ASSERT_TRUE(prepared_packet.Patch(17, patch));
+    memcpy(&payload[17], patch, sizeof(patch));
+    uint8_t expected_packet[LayoutTransport::get_transmission_buffer_size()] = {};
+    LayoutTransport builder(rx_port, 0x1021, 0xFFFF, 0x0000);
+    builder.WriteData(payload);
+    builder.SendData();  // Advances the sequence number to match the prepared packet.
+    builder.WriteData(payload);
+    TEST_ASSERT_EQUAL_UINT16(prepared_packet.get_packet_size(), builder.EncodeData(expected_packet));
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(expected_packet, prepared_packet.get_packet(), prepared_packet.get_packet_size());
+}
+
+/// Verifies that the TransportLayer class supports the packet layouts that differ from the default layout.
+void test_transport_layer_packet_layouts()
+{
+    VerifyPacketLayout<kBufferLayout>();
+    VerifyPacketLayout<PacketLayout<129, 0, false>>();     // No start byte.
+    VerifyPacketLayout<PacketLayout<129, 0, true, 2>>();   // 16-bit payload size field.
+    VerifyPacketLayout<PacketLayout<0x7E, 0xAA>>();        // Custom start and delimiter byte values.
+    VerifyPacketLayout<PacketLayout<129, 0xAA, false, 2>>();
+
+    // Verifies that the packets whose 16-bit payload size field exceeds the COBS payload size limit are rejected.
+    using WideTransport = TransportLayer<uint16_t, 48, 48, 0, CRCProcessor<uint16_t>, PacketLayout<129, 0, true, 2>>;
+    CompactStreamMock<256> port;
+    WideTransport transmitter(port, 0x1021, 0xFFFF, 0x0000);
+    WideTransport receiver(port, 0x1021, 0xFFFF, 0x0000);
+    const uint8_t value = 5;
+    transmitter.WriteData(value);
+    transmitter.SendData();
+    uint8_t packet[16] = {};
+    memcpy(packet, port.get_transmitted_data(), port.get_transmitted_size());
+    packet[2] = 1;
+    port.PushReceptionData(packet, port.get_transmitted_size());
+    TEST_ASSERT_FALSE(receiver.ReceiveData());
+    TEST_ASSERT_EQUAL_UINT8(
+        static_cast<uint8_t>(kTransportStatusCodes::kInvalidPayloadSize),
+        receiver.get_runtime_status()
+    );
+}
+
+/**
+ * @brief Sends and receives the same 8-byte payload repeatedly using the input packet layout and reports the time each
+ * round trip takes.
+ *
+ * @tparam LayoutType The PacketLayout used by the benchmarked TransportLayer instances.
+ * @param label The label used to identify the benchmarked layout in the reported message.
+ * @returns the number of bytes transmitted for each packet.
+ */
+template <typename LayoutType>
+size_t BenchmarkPacketLayout(const char* label)
+{
+    constexpr uint16_t kRepetitions = 50;
+    using TransportType             = TransportLayer<uint16_t, 48, 48, 0, CRCProcessor<uint16_t>, LayoutType>;
+    CompactStreamMock<256> port;
+    TransportType transmitter(port, 0x1021, 0xFFFF, 0x0000);
+    TransportType receiver(port, 0x1021, 0xFFFF, 0x0000);
+    const uint8_t payload[8] = {1, 0, 3, 4, 0, 6, 7, 8};
+    uint8_t received[8]      = {};
+
+    size_t packet_size        = 0;
+    const uint32_t start_time = micros();
+    for (uint16_t i = 0; i < kRepetitions; i++)
+    {
+        transmitter.WriteData(payload);
+        transmitter.SendData();
+        packet_size = port.get_transmitted_size();
+        port.PushReceptionData(port.get_transmitted_data(), packet_size);
+        port.flush();
+        TEST_ASSERT_TRUE(receiver.ReceiveData());
+        TEST_ASSERT_TRUE(receiver.ReadData(received));
+    }
+    const uint32_t elapsed_time = micros() - start_time;
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(payload, received, sizeof(payload));
+
+    char message[96];
+    snprintf(
+        message,
+        sizeof(message),
+        "%s: %lu us per round trip, %u bytes per packet",
+        label,
+        static_cast<unsigned long>(elapsed_time / kRepetitions),
+        static_cast<unsigned>(packet_size)
+    );
+    TEST_MESSAGE(message);
+    return packet_size;
+}
+
+/// Verifies that the delimiter-framed packet layout transmits and receives the packets without the start byte and the
+/// payload size, and that the receiver resynchronizes with the stream at the next delimiter byte.
+void test_transport_layer_delimited_layout()
+{
+    using DelimitedTransport = TransportLayer<uint16_t, 48, 48, 1, CRCProcessor<uint16_t>, kDelimitedLayout>;
+    CompactStreamMock<256> port;
+    DelimitedTransport transmitter(port, 0x1021, 0xFFFF, 0x0000);
+    DelimitedTransport receiver(port, 0x1021, 0xFFFF, 0x0000);
+    const uint8_t payload[6] = {0, 10, 0, 0, 20, 0};
+
+    // Verifies that the staged and the scatter-gather SendData() methods transmit identical packets whose only
+    // unencoded delimiter byte value is the last byte.
+    transmitter.WriteData(payload);
+    transmitter.SendData();
+    uint8_t packet[16]       = {};
+    const size_t packet_size = port.get_transmitted_size();
+    TEST_ASSERT_EQUAL_size_t(sizeof(payload) + 1 + 2 + 2, packet_size);  // Sequence number, checksum, COBS bytes.
+    memcpy(packet, port.get_transmitted_data(), packet_size);
+    for (size_t i = 0; i < packet_size - 1; i++) TEST_ASSERT_NOT_EQUAL(0, packet[i]);
+    TEST_ASSERT_EQUAL_UINT8(0, packet[packet_size - 1]);
+
+    DelimitedTransport gather_transmitter(port, 0x1021, 0xFFFF, 0x0000);
+    port.flush();
+    const DataSegment segments[] = {{payload, 2}, {&payload[2], 4}};
+    TEST_ASSERT_TRUE(gather_transmitter.SendData(segments));
+    TEST_ASSERT_EQUAL_size_t(packet_size, port.get_transmitted_size());
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(packet, port.get_transmitted_data(), packet_size);
+
+    // Verifies that the noise that ends with a delimiter byte is rejected without affecting the following packet.
+    const uint8_t noise[] = {0x11, 0x22, 0};
+    port.PushReceptionData(noise, sizeof(noise));
+    port.PushReceptionData(packet, packet_size);
+    TEST_ASSERT_FALSE(receiver.ReceiveData());
+    TEST_ASSERT_EQUAL_UINT8(
+        static_cast<uint8_t>(kTransportStatusCodes::kInvalidPayloadSize),
+        receiver.get_runtime_status()
+    );
+    uint8_t received[6] = {};
+    TEST_ASSERT_TRUE(receiver.ReceiveData());
+    TEST_ASSERT_EQUAL_UINT8(sizeof(payload), receiver.get_bytes_in_reception_buffer());
+    TEST_ASSERT_TRUE(receiver.ReadData(received));
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(payload, received, sizeof(payload));
+
+    // Verifies that the corrupted packets fail the checksum verification.
+    packet[3] ^= 0x40;
+    port.PushReceptionData(packet, packet_size);
+    TEST_ASSERT_FALSE(receiver.ReceiveData());
+    TEST_ASSERT_EQUAL_UINT8(
+        static_cast<uint8_t>(kTransportStatusCodes::kCRCCheckFailed),
+        receiver.get_runtime_status()
+    );
+
+    // Compares the delimiter-framed layout against the default layout for small payloads.
+    const size_t default_size   = BenchmarkPacketLayout<kBufferLayout>("Default layout");
+    const size_t delimited_size = BenchmarkPacketLayout<kDelimitedLayout>("Delimited layout");
+    TEST_ASSERT_EQUAL_size_t(default_size - 2, delimited_size);
+}
+
+/// Verifies that the TransportLayer class tracks the health of the communication link and exports it to the PC as
+/// telemetry packets.
+void test_transport_layer_telemetry()
+{
+    CompactStreamMock<1024> tx_port;
+    CompactStreamMock<1024> rx_port;
+    TransportLayer<uint16_t, 96, 96> transmitter(tx_port, 0x1021, 0xFFFF, 0x0000);
+    TransportLayer<uint16_t, 96, 96> receiver(rx_port, 0x1021, 0xFFFF, 0x0000);
+    receiver.SetTimeouts(500, 0);
+
+    // Sends three valid packets of different sizes.
+    uint8_t payload[40];
+    memset(payload, 0x55, sizeof(payload));
+    for (uint8_t i = 1; i <= 3; i++)
+    {
+        transmitter.WriteData(payload, i * 10);
+        transmitter.SendData();
+    }
+    tx_port.MoveTransmittedData(rx_port);
+    for (uint8_t i = 1; i <= 3; i++) TEST_ASSERT_TRUE(receiver.ReceiveData());
+
+    // Sends a corrupted packet, a packet with an invalid payload size, and a stalled packet.
+    tx_port.reset();
+    transmitter.WriteData(payload, 8);
+    transmitter.SendData();
+    uint8_t packet[32];
+    const size_t packet_size = tx_port.get_transmitted_size();
+    memcpy(packet, tx_port.get_transmitted_data(), packet_size);
+    packet[5] ^= 0x01;
+    rx_port.PushReceptionData(packet, packet_size);
+    TEST_ASSERT_FALSE(receiver.ReceiveData());
+    const uint8_t invalid_size[] = {kBufferLayout::kStartByte, 200, 1, 1, 1, 1};
+    rx_port.PushReceptionData(invalid_size, sizeof(invalid_size));
+    TEST_ASSERT_FALSE(receiver.ReceiveData());
+    rx_port.PushReceptionData(tx_port.get_transmitted_data(), packet_size - 3);
+    TEST_ASSERT_FALSE(receiver.ReceiveData());
+
+    // Verifies the link statistics of both instances.
+    const LinkStatistics& statistics = receiver.get_link_statistics();
+    TEST_ASSERT_EQUAL_UINT32(3, statistics.received_packets);
+    TEST_ASSERT_EQUAL_UINT32(1, statistics.checksum_errors);
+    TEST_ASSERT_EQUAL_UINT32(1, statistics.framing_errors);
+    TEST_ASSERT_EQUAL_UINT32(1, statistics.timeout_errors);
+    TEST_ASSERT_EQUAL_UINT8(30, statistics.largest_received_payload);
+    TEST_ASSERT_GREATER_OR_EQUAL_UINT16(3 * 10 + 3 * 6, statistics.reception_backlog_peak);
+    TEST_ASSERT_EQUAL_UINT32(4, transmitter.get_link_statistics().transmitted_packets);
+    TEST_ASSERT_EQUAL_UINT8(30, transmitter.get_link_statistics().largest_transmitted_payload);
+
+    // Sends the receiver's telemetry packet back to the transmitter and verifies its contents.
+    LatencyHistogram reception_histogram;
+    reception_histogram.Record(300);
+    receiver.SetLatencyHistograms(&reception_histogram, nullptr);
+    TEST_ASSERT_TRUE(receiver.SendTelemetry());
+    rx_port.MoveTransmittedData(tx_port);
+    TEST_ASSERT_TRUE(transmitter.ReceiveData());
+    uint8_t header[7];
+    uint32_t fields[17];
+    TEST_ASSERT_TRUE(transmitter.ReadData(header));
+    TEST_ASSERT_TRUE(transmitter.ReadData(fields));
+    TEST_ASSERT_EQUAL_UINT8(0, transmitter.get_bytes_in_reception_buffer() - sizeof(header) - sizeof(fields));
+    const uint8_t expected_header[] = {kReservedPacketTypes::kTelemetry, 1, 17, 96, 96, 0, 2};
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(expected_header, header, sizeof(header));
+    TEST_ASSERT_EQUAL_UINT32(3, fields[2]);
+    TEST_ASSERT_EQUAL_UINT32(1, fields[3]);
+    TEST_ASSERT_EQUAL_UINT32(1, fields[4]);
+    TEST_ASSERT_EQUAL_UINT32(1, fields[5]);
+    TEST_ASSERT_EQUAL_UINT32(30, fields[9]);
+    TEST_ASSERT_EQUAL_UINT32(300, fields[13]);
+    TEST_ASSERT_EQUAL_UINT32(0, fields[16]);
+    TEST_ASSERT_EQUAL_UINT32(1, receiver.get_link_statistics().transmitted_packets);
+
+    // Verifies that the periodic telemetry is sent by the ReceiveData() method once the interval passes.
+    rx_port.reset();
+    receiver.SetTelemetryInterval(5);
+    TEST_ASSERT_FALSE(receiver.ReceiveData());
+    TEST_ASSERT_EQUAL_size_t(0, rx_port.get_transmitted_size());
+    delay(6);
+    TEST_ASSERT_FALSE(receiver.ReceiveData());
+    TEST_ASSERT_GREATER_THAN_size_t(0, rx_port.get_transmitted_size());
+
+    // Verifies that instances with small payloads omit the trailing telemetry fields.
+    CompactStreamMock<256> small_port;
+    TransportLayer<uint8_t, 16, 16> small_transport(small_port);
+    TEST_ASSERT_TRUE(small_transport.SendTelemetry());
+    TEST_ASSERT_EQUAL_UINT8(2, small_port.get_transmitted_data()[5]);
+
+    receiver.ResetLinkStatistics();
+    TEST_ASSERT_EQUAL_UINT32(0, receiver.get_link_statistics().received_packets);
+}
+
+/// Implements the checksum engine interface by forwarding all calls to the wrapped CRCProcessor and counting the number
+/// of UpdateChecksum() calls. Used to verify that the TransportLayer class supports custom checksum engines.
+class CountingChecksumEngine
+{
+    public:
+        using ChecksumType                      = uint16_t;
+        static constexpr uint8_t kChecksumSize = 2;
+
+        CountingChecksumEngine(const uint16_t polynomial, const uint16_t initial_value, const uint16_t final_xor) :
+            _crc_processor(polynomial, initial_value, final_xor)
+        {}
+
+        [[nodiscard]]
+        uint16_t get_initial_value() const
+        {
+            return _crc_processor.get_initial_value();
+        }
+
+        uint16_t UpdateChecksum(const uint16_t checksum, const uint8_t* data, const uint16_t size) const
+        {
+            update_calls++;
+            return _crc_processor.UpdateChecksum(checksum, data, size);
+        }
+
+        [[nodiscard]]
+        uint16_t FinalizeChecksum(const uint16_t checksum) const
+        {
+            return _crc_processor.FinalizeChecksum(checksum);
+        }
+
+        [[nodiscard]]
+        bool VerifyChecksum(const uint16_t checksum, const uint16_t received_checksum) const
+        {
+            return _crc_processor.VerifyChecksum(checksum, received_checksum);
+        }
+
+        mutable uint16_t update_calls = 0;
+
+    private:
+        CRCProcessor<uint16_t> _crc_processor;
+};
+
+/// Verifies that the TransportLayer class uses the checksum engine specified via its template parameter and that the
+/// engine produces the same packets as the default CRCProcessor engine.
+void test_transport_layer_checksum_engine()
+{
+    StreamMock<> default_port;
+    StreamMock<> engine_port;
+    TransportLayer<uint16_t, 64, 64> default_transmitter(default_port, 0x1021, 0xFFFF, 0x0000);
+    TransportLayer<uint16_t, 64, 64, 0, CountingChecksumEngine> engine_transmitter(engine_port, 0x1021, 0xFFFF, 0x0000);
+
+    const uint8_t payload[10] = {1, 2, 0, 4, 5, 0, 0, 8, 9, 10};
+    default_transmitter.WriteData(payload);
+    default_transmitter.SendData();
+    engine_transmitter.WriteData(payload);
+    engine_transmitter.SendData();
+    TEST_ASSERT_EQUAL_UINT16(1, engine_transmitter.get_checksum_engine().update_calls);
+    TEST_ASSERT_EQUAL_UINT32(default_port.tx_buffer_index, engine_port.tx_buffer_index);
+    TEST_ASSERT_EQUAL_INT16_ARRAY(default_port.tx_buffer, engine_port.tx_buffer, default_port.tx_buffer_index);
+
+    // Verifies that the engine is used to verify the received packets.
+    for (size_t i = 0; i < engine_port.tx_buffer_index; i++) engine_port.rx_buffer[i] = engine_port.tx_buffer[i];
+    TEST_ASSERT_TRUE(engine_transmitter.ReceiveData());
+    TEST_ASSERT_EQUAL_UINT16(2, engine_transmitter.get_checksum_engine().update_calls);
+}
+
+/// Verifies the functioning of the PreparedPacket class and the COBSProcessor PatchPayload() method.
+void test_prepared_packet()
+{
+    CompactStreamMock<1024> tx_port;
+    CompactStreamMock<1024> rx_port;
+    TransportLayer<uint16_t, 64, 64, 1> transmitter(tx_port, 0x1021, 0xFFFF, 0x0000);
+    TransportLayer<uint16_t, 64, 64, 1> receiver(rx_port, 0x1021, 0xFFFF, 0x0000);
+    PreparedPacket<TransportLayer<uint16_t, 64, 64, 1>> packet(transmitter);
+
+    // Verifies that the packet cannot be sent or patched before it is prepared.
+    const uint32_t counter = 0;
+    TEST_ASSERT_FALSE(packet.Send());
+    TEST_ASSERT_FALSE(packet.Patch(0, counter));
+
+    // Prepares the packet with a payload that contains both zero and non-zero bytes.
+    uint8_t payload[40] = {};
+    for (uint8_t i = 0; i < 40; i += 3) payload[i] = i + 1;
+    TEST_ASSERT_TRUE(packet.WriteData(payload));
+    TEST_ASSERT_EQUAL_UINT16(47, packet.Prepare());
+    TEST_ASSERT_EQUAL_UINT8(0, transmitter.get_bytes_in_transmission_buffer());
+
+    // Verifies that the prepared packet is transmitted with a single write() and received intact.
+    TEST_ASSERT_TRUE(packet.Send());
+    TEST_ASSERT_TRUE(packet.Send());
+    tx_port.MoveTransmittedData(rx_port);
+    uint8_t received[40] = {};
+    for (uint8_t i = 0; i < 2; i++)
+    {
+        TEST_ASSERT_TRUE(receiver.ReceiveData());
+        TEST_ASSERT_TRUE(receiver.ReadData(received));
+        TEST_ASSERT_EQUAL_UINT8_ARRAY(payload, received, sizeof(payload));
+    }
+
+    // Applies a series of pseudo-random patches, biased towards zero bytes to exercise the delimiter chain
+    // re-encoding, and verifies that each patched packet matches the packet constructed from scratch.
+    uint32_t state = 0x12345678;
+    uint8_t patch[8] = {};
+    uint8_t expected_packet[TransportLayer<uint16_t, 64, 64, 1>::get_transmission_buffer_size()] = {};
+    for (uint16_t iteration = 0; iteration < 500; iteration++)
+    {
+        state ^= state << 13;
+        state ^= state >> 17;
+        state ^= state << 5;
+        const uint8_t patch_size   = 1 + state % 8;
+        const uint8_t patch_offset = (state >> 8) % (sizeof(payload) - patch_size + 1);
+        for (uint8_t i = 0; i < patch_size; i++)
+        {
+            patch[i] = (state >> (16 + i)) & 1 ? 0 : static_cast<uint8_t>(state >> (i * 3));
+        }
+        TEST_ASSERT_TRUE(packet.Patch(patch_offset, patch, patch_size));
+        memcpy(&payload[patch_offset], patch, patch_size);
+
+        // The reference packet must use the same sequence number as the prepared packet.
+        TransportLayer<uint16_t, 64, 64, 1> builder(rx_port, 0x1021, 0xFFFF, 0x0000);
+        builder.WriteData(payload);
+        TEST_ASSERT_EQUAL_UINT16(packet.get_packet_size(), builder.EncodeData(expected_packet));
+        TEST_ASSERT_EQUAL_UINT8_ARRAY(expected_packet, packet.get_packet(), packet.get_packet_size());
+    }
+
+    // Verifies that the patched packet is received intact.
+    TEST_ASSERT_TRUE(packet.Send());
+    tx_port.MoveTransmittedData(rx_port);
+    TEST_ASSERT_TRUE(receiver.ReceiveData());
+    TEST_ASSERT_TRUE(receiver.ReadData(received));
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(payload, received, sizeof(payload));
+
+    // Verifies that the patches that extend past the end of the payload are refused.
+    TEST_ASSERT_FALSE(packet.Patch(37, counter));
+    TEST_ASSERT_TRUE(packet.Patch(36, counter));
+}
+
+/// Verifies the functioning of the LatencyHistogram class and the latency recording of the TransportLayer class.
+void test_latency_histogram()
+{
+    // Verifies the bucket boundaries.
+    TEST_ASSERT_EQUAL_UINT8(0, LatencyHistogram::GetBucketIndex(0));
+    TEST_ASSERT_EQUAL_UINT8(1, LatencyHistogram::GetBucketIndex(1));
+    TEST_ASSERT_EQUAL_UINT8(2, LatencyHistogram::GetBucketIndex(2));
+    TEST_ASSERT_EQUAL_UINT8(2, LatencyHistogram::GetBucketIndex(3));
+    TEST_ASSERT_EQUAL_UINT8(10, LatencyHistogram::GetBucketIndex(1000));
+    TEST_ASSERT_EQUAL_UINT8(32, LatencyHistogram::GetBucketIndex(0xFFFFFFFF));
+    TEST_ASSERT_EQUAL_UINT32(1023, LatencyHistogram::GetBucketUpperBound(10));
+    TEST_ASSERT_EQUAL_UINT32(0xFFFFFFFF, LatencyHistogram::GetBucketUpperBound(32));
+
+    // Records 98 fast and 2 slow latencies and verifies that the tail is visible in the percentiles.
+    LatencyHistogram histogram;
+    TEST_ASSERT_EQUAL_UINT32(0, histogram.GetPercentile(50));
+    for (uint32_t i = 0; i < 98; i++) histogram.Record(100 + i % 20);
+    histogram.Record(5000);
+    histogram.Record(20000);
+    TEST_ASSERT_EQUAL_UINT32(100, histogram.get_count());
+    TEST_ASSERT_EQUAL_UINT32(20000, histogram.get_maximum());
+    TEST_ASSERT_EQUAL_UINT32(98, histogram.get_bucket(7));
+    TEST_ASSERT_EQUAL_UINT32(127, histogram.GetPercentile(50));
+    TEST_ASSERT_EQUAL_UINT32(127, histogram.GetPercentile(98));
+    TEST_ASSERT_EQUAL_UINT32(8191, histogram.GetPercentile(99));
+    TEST_ASSERT_EQUAL_UINT32(20000, histogram.GetPercentile(100));
+    histogram.Reset();
+    TEST_ASSERT_EQUAL_UINT32(0, histogram.get_count());
+    TEST_ASSERT_EQUAL_UINT32(0, histogram.get_bucket(7));
+
+    // Verifies that the TransportLayer instances record the latency of each transmitted and received packet once the
+    // histograms are attached.
+    CompactStreamMock<2048> tx_port;
+    CompactStreamMock<2048> rx_port;
+    TransportLayer<uint8_t, 32, 32> transmitter(tx_port);
+    TransportLayer<uint8_t, 32, 32> receiver(rx_port);
+    LatencyHistogram transmission_histogram;
+    LatencyHistogram reception_histogram;
+    transmitter.SetLatencyHistograms(nullptr, &transmission_histogram);
+    receiver.SetLatencyHistograms(&reception_histogram, nullptr);
+    for (uint32_t i = 0; i < 10; i++)
+    {
+        transmitter.WriteData(i);
+        transmitter.SendData();
+    }
+    tx_port.MoveTransmittedData(rx_port);
+    for (uint32_t i = 0; i < 10; i++) TEST_ASSERT_TRUE(receiver.ReceiveData());
+    TEST_ASSERT_EQUAL_UINT32(10, transmission_histogram.get_count());
+    TEST_ASSERT_EQUAL_UINT32(10, reception_histogram.get_count());
+
+    // Sends the reception histogram, which is split into multiple packets, and verifies that the received packets
+    // reproduce it. The staged payload of the transmitter is preserved.
+    const uint8_t staged_value = 42;
+    transmitter.WriteData(staged_value);
+    transmitter.SetLatencyHistograms(nullptr, nullptr);
+    receiver.SetLatencyHistograms(nullptr, nullptr);
+    TEST_ASSERT_TRUE(reception_histogram.Send(transmitter, 7));
+    tx_port.MoveTransmittedData(rx_port);
+    uint8_t received_buckets = 0;
+    while (received_buckets < LatencyHistogram::kBucketCount)
+    {
+        TEST_ASSERT_TRUE(receiver.ReceiveData());
+        uint8_t header[4];
+        uint32_t summary[2];
+        TEST_ASSERT_TRUE(receiver.ReadData(header));
+        TEST_ASSERT_TRUE(receiver.ReadData(summary));
+        TEST_ASSERT_EQUAL_UINT8(kReservedPacketTypes::kLatencyHistogram, header[0]);
+        TEST_ASSERT_EQUAL_UINT8(7, header[1]);
+        TEST_ASSERT_EQUAL_UINT8(received_buckets, header[2]);
+        TEST_ASSERT_EQUAL_UINT32(reception_histogram.get_count(), summary[0]);
+        TEST_ASSERT_EQUAL_UINT32(reception_histogram.get_maximum(), summary[1]);
+        TEST_ASSERT_EQUAL_UINT8(header[3] * sizeof(uint32_t), receiver.get_bytes_in_reception_buffer() - 12);
+        for (uint8_t i = 0; i < header[3]; i++)
+        {
+            uint32_t bucket = 0;
+            TEST_ASSERT_TRUE(receiver.ReadData(bucket));
+            TEST_ASSERT_EQUAL_UINT32(reception_histogram.get_bucket(received_buckets + i), bucket);
+        }
+        received_buckets += header[3];
+    }
+    TEST_ASSERT_EQUAL_UINT8(1, transmitter.get_bytes_in_transmission_buffer());
+}
+
 /// Specifies the test functions to be executed and controls their runtime.
 int RunUnityTests()
 {
@@ -1033,9 +3158,19 @@ int RunUnityTests()
 #endif
 
     RUN_TEST(test_crc_processor_calculate_checksum);
+    RUN_TEST(test_crc_processor_patch_checksum);
+    RUN_TEST(test_crc_processor_kernels);
+    RUN_TEST(test_crc_processor_reflected);
+
+    // Fletcher Processor
+    RUN_TEST(test_fletcher_processor);
+
+    // Compression Processor
+    RUN_TEST(test_compression_processor);
 
     // Stream Mock
     RUN_TEST(test_stream_mock);
+    RUN_TEST(test_compact_stream_mock_stress);
 
     // TransportLayer Write / Read Data
     RUN_TEST(test_transport_layer_buffer_manipulation);
@@ -1047,6 +3182,44 @@ int RunUnityTests()
     RUN_TEST(test_transport_layer_delimiter_not_found_error);
     RUN_TEST(test_transport_layer_postamble_timeout_error);
     RUN_TEST(test_transport_layer_delimiter_found_too_early_error);
+    RUN_TEST(test_transport_layer_gather_transmission);
+    RUN_TEST(test_transport_layer_start_byte_search);
+    RUN_TEST(test_transport_layer_reception_timeouts);
+    RUN_TEST(test_transport_layer_packet_layouts);
+    RUN_TEST(test_transport_layer_delimited_layout);
+    RUN_TEST(test_transport_layer_checksum_engine);
+    RUN_TEST(test_transport_layer_telemetry);
+
+    // TransportLayer Sequence Numbers
+    RUN_TEST(test_transport_layer_sequence_numbers);
+
+    // Loopback Stream Mock
+    RUN_TEST(test_loopback_stream_lossy_channel);
+
+    // Reliable Channel
+    RUN_TEST(test_reliable_channel_delivery);
+
+    // Compressed Channel
+    RUN_TEST(test_compressed_channel);
+
+    // Reception Queue
+    RUN_TEST(test_reception_queue);
+
+    // Interrupt Receiver
+    RUN_TEST(test_spsc_ring);
+    RUN_TEST(test_interrupt_receiver);
+
+    // Streaming Receiver
+    RUN_TEST(test_streaming_receiver);
+
+    // Transmission Queue
+    RUN_TEST(test_transmission_queue);
+
+    // Prepared Packet
+    RUN_TEST(test_prepared_packet);
+
+    // Latency Histogram
+    RUN_TEST(test_latency_histogram);
 
     return UNITY_END();
 }